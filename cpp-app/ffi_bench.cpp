@@ -0,0 +1,182 @@
+// Google Benchmark harness for the C++ <-> Rust FFI boundary
+//
+// Measures the cost of each kind of bridge crossing so regressions show
+// up in ns/op instead of production latency graphs:
+//   - pure-Rust calculate_bmi vs the equivalent C++ method (baseline)
+//   - process_person (seven getter calls) vs snapshot/interned variants
+//   - String-returning vs POD-returning bridge structs
+//   - per-object calls vs one batched crossing
+//
+// Allocation counts come from counting replacements of operator
+// new/delete local to this binary, reported as allocs/op per benchmark.
+
+#include "person.h"
+
+// Include the cxx-generated header (for Rust FFI)
+#include "rust-lib/src/lib.rs.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+// ----------------------------------------------------------------------------
+// Allocation counting - replace global new/delete for this binary only
+// ----------------------------------------------------------------------------
+
+static std::atomic<size_t> g_alloc_count{0};
+
+void* operator new(size_t size) {
+    g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+namespace {
+
+// Report allocations per iteration for the benchmarked region
+class AllocCounter {
+public:
+    explicit AllocCounter(benchmark::State& state)
+        : state_(state), start_(g_alloc_count.load()) {}
+    ~AllocCounter() {
+        state_.counters["allocs/op"] = benchmark::Counter(
+            static_cast<double>(g_alloc_count.load() - start_),
+            benchmark::Counter::kAvgIterations);
+    }
+
+private:
+    benchmark::State& state_;
+    size_t start_;
+};
+
+std::unique_ptr<Person> make_bench_person() {
+    auto address = std::make_shared<Address>("123 Main St", "New York", "10001");
+    auto contact = std::make_shared<ContactInfo>("bench@example.com", "555-1234", address);
+    return std::make_unique<Person>(30, 1.75, "Bench Person", contact);
+}
+
+// ----------------------------------------------------------------------------
+// Baseline: the same arithmetic with and without a bridge crossing
+// ----------------------------------------------------------------------------
+
+void BM_CalculateBmi_Cpp(benchmark::State& state) {
+    auto person = make_bench_person();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(person->calculate_bmi(75.0));
+    }
+}
+BENCHMARK(BM_CalculateBmi_Cpp);
+
+void BM_CalculateBmi_Rust(benchmark::State& state) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(calculate_bmi(75.0, 1.75));
+    }
+}
+BENCHMARK(BM_CalculateBmi_Rust);
+
+// ----------------------------------------------------------------------------
+// Per-object processing: getter chain vs snapshot vs interned (POD) result
+// ----------------------------------------------------------------------------
+
+void BM_ProcessPerson_GetterChain(benchmark::State& state) {
+    auto person = make_bench_person();
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        PersonInfo info = process_person(*person);
+        benchmark::DoNotOptimize(info);
+    }
+}
+BENCHMARK(BM_ProcessPerson_GetterChain);
+
+void BM_ProcessPerson_Snapshot(benchmark::State& state) {
+    auto person = make_bench_person();
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        PersonInfo info = process_person_snapshot(*person);
+        benchmark::DoNotOptimize(info);
+    }
+}
+BENCHMARK(BM_ProcessPerson_Snapshot);
+
+void BM_ProcessPerson_InternedPod(benchmark::State& state) {
+    auto person = make_bench_person();
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        PersonInfoInterned info = process_person_interned(*person);
+        benchmark::DoNotOptimize(info);
+    }
+}
+BENCHMARK(BM_ProcessPerson_InternedPod);
+
+// ----------------------------------------------------------------------------
+// Batched crossing: one FFI transition amortized over N objects
+// ----------------------------------------------------------------------------
+
+void BM_ProcessPersonBatch(benchmark::State& state) {
+    const size_t batch_size = static_cast<size_t>(state.range(0));
+    std::vector<std::unique_ptr<Person>> persons;
+    std::vector<const Person*> pointers;
+    for (size_t i = 0; i < batch_size; ++i) {
+        persons.push_back(make_bench_person());
+        pointers.push_back(persons.back().get());
+    }
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        rust::Vec<PersonInfo> results = process_person_batch(pointers.data(), pointers.size());
+        benchmark::DoNotOptimize(results);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(batch_size));
+}
+BENCHMARK(BM_ProcessPersonBatch)->Arg(1)->Arg(64)->Arg(4096);
+
+// ----------------------------------------------------------------------------
+// Other hot crossings
+// ----------------------------------------------------------------------------
+
+void BM_ValidateContact(benchmark::State& state) {
+    auto person = make_bench_person();
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(validate_contact(person->contact()));
+    }
+}
+BENCHMARK(BM_ValidateContact);
+
+void BM_AnalyzeHealth(benchmark::State& state) {
+    auto person = make_bench_person();
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        HealthAnalysis analysis = analyze_health(*person, 75.0);
+        benchmark::DoNotOptimize(analysis);
+    }
+}
+BENCHMARK(BM_AnalyzeHealth);
+
+void BM_AnalyzeHealthColumns(benchmark::State& state) {
+    const size_t batch_size = static_cast<size_t>(state.range(0));
+    auto person = make_bench_person();
+    PersonColumnBatch batch;
+    for (size_t i = 0; i < batch_size; ++i) {
+        batch.push_person(*person, 75.0);
+    }
+    AllocCounter allocs(state);
+    for (auto _ : state) {
+        HealthColumns results = analyze_health_columns(batch);
+        benchmark::DoNotOptimize(results);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            static_cast<int64_t>(batch_size));
+}
+BENCHMARK(BM_AnalyzeHealthColumns)->Arg(64)->Arg(4096);
+
+}  // namespace
+
+BENCHMARK_MAIN();
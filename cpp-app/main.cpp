@@ -1,59 +1,301 @@
 // Include our C++ definitions (existing C++ code)
 #include "person.h"
+#include "person_file.h"
 
 // Include the cxx-generated header (for Rust FFI)
 #include "rust-lib/src/lib.rs.h"
 
+#include <atomic>
+#include <cstdio>   // std::remove for the record-file demo
+#include <cstdlib>
+#include <fstream>  // Writing the demo city-risk table
+#include <new>
 #include <iostream>
 #include <string>
+#include <string_view>
 #include <memory>
+#include <vector>
+#include <chrono>
+#include <thread>
 #include <dlfcn.h>  // For dlopen, dlsym, dlclose (dynamic loading)
+#if defined(__linux__)
+#include <sys/eventfd.h>  // Completion signaling for the async bridge demo
+#include <unistd.h>
+#endif
+
+// ----------------------------------------------------------------------------
+// Allocation tracking (FFI_ALLOC_STATS builds only)
+// Replace global new/delete for this binary and count C++ heap traffic;
+// the Rust side counts through its alloc-stats #[global_allocator]
+// (same one-switch CMake option covers both, like FFI_BRIDGE_STATS).
+// ----------------------------------------------------------------------------
+#ifdef FFI_ALLOC_STATS
+static std::atomic<uint64_t> g_cpp_alloc_count{0};
+static std::atomic<uint64_t> g_cpp_alloc_bytes{0};
+
+void* operator new(size_t size) {
+    g_cpp_alloc_count.fetch_add(1, std::memory_order_relaxed);
+    g_cpp_alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+// Per-call heap delta across one bridge call, both sides of the fence
+struct AllocDelta {
+    uint64_t cpp_allocs;
+    uint64_t cpp_bytes;
+    uint64_t rust_allocs;
+    uint64_t rust_bytes;
+};
+
+template <typename Fn>
+AllocDelta measure_allocs(Fn&& fn) {
+    uint64_t cpp_count = g_cpp_alloc_count.load(std::memory_order_relaxed);
+    uint64_t cpp_bytes = g_cpp_alloc_bytes.load(std::memory_order_relaxed);
+    uint64_t rust_count = rust_alloc_count();
+    uint64_t rust_bytes = rust_alloc_bytes();
+    fn();
+    return AllocDelta{
+        g_cpp_alloc_count.load(std::memory_order_relaxed) - cpp_count,
+        g_cpp_alloc_bytes.load(std::memory_order_relaxed) - cpp_bytes,
+        rust_alloc_count() - rust_count,
+        rust_alloc_bytes() - rust_bytes,
+    };
+}
+
+void print_alloc_row(const char* name, const AllocDelta& delta) {
+    std::cout << "  " << name << ": " << delta.rust_allocs << " allocs, "
+              << delta.rust_bytes << " bytes (Rust) | " << delta.cpp_allocs
+              << " allocs, " << delta.cpp_bytes << " bytes (C++)"
+              << std::endl;
+}
+#endif
+
+// C-layout mirrors of the #[repr(C)] structs exported by rust-lib/src/lib.rs
+// Keep field order in sync with RsPersonInfo / RsApiTable on the Rust side
+
+struct RsPersonInfo {
+    uint8_t is_adult;
+    uint8_t bmi_category;
+    uint32_t city_id;
+    size_t name_length;
+};
+
+struct RsApiTable {
+    uint32_t version;
+    double (*calculate_bmi)(double, double);
+    size_t (*greet_person)(const char*);
+    size_t (*process_person_batch)(const Person* const*, size_t, RsPersonInfo*);
+};
+
+// ABI version this binary was built against (must match the library)
+constexpr uint32_t RS_API_VERSION = 1;
 
 // Dynamic library loader class
+//
+// Supports a configurable search path list and a choice of binding mode:
+// Lazy defers PLT resolution to the first call through each entry (the
+// default dlopen behaviour), Eager maps with RTLD_NOW | RTLD_GLOBAL so
+// every relocation is resolved at load time and no call ever pays the
+// lazy-binding stub. Combined with prewarm() - which drives one call
+// through every table entry to fault in its code pages - the first real
+// request after a library swap sees steady-state latency.
 class DynamicRustLibrary {
+public:
+    enum class Binding {
+        Lazy,   // RTLD_LAZY: resolve symbols on first use
+        Eager,  // RTLD_NOW | RTLD_GLOBAL: resolve everything up front
+    };
+
+    // Per-phase wall-clock costs of the last successful load, plus where
+    // the library was actually found - the loader's stats surface
+    struct LoadStats {
+        std::string resolved_path;
+        Binding binding = Binding::Lazy;
+        double dlopen_ms = 0.0;   // map + relocate (all of it, if eager)
+        double resolve_ms = 0.0;  // dlsym + version handshake
+        double prewarm_ms = 0.0;  // one pass through the table (0 if skipped)
+        size_t prewarmed_entries = 0;
+    };
+
 private:
     void* handle;
-    
+    const RsApiTable* api_table;
+    std::vector<std::string> search_paths_;
+    LoadStats stats_;
+
+    static double elapsed_ms(std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double, std::milli>(
+                   std::chrono::steady_clock::now() - start).count();
+    }
+
 public:
-    // Function pointer typedefs
-    using calculate_bmi_fn = double(*)(double, double);
-    
-    // Function pointers
-    calculate_bmi_fn calculate_bmi_ptr;
-    
-    DynamicRustLibrary() : handle(nullptr), calculate_bmi_ptr(nullptr) {}
-    
+    // Signature of the single stable entry point exported by the library
+    using get_api_table_fn = const RsApiTable* (*)();
+
+    DynamicRustLibrary() : handle(nullptr), api_table(nullptr) {}
+
     ~DynamicRustLibrary() {
         if (handle) {
             dlclose(handle);
         }
     }
-    
-    bool load(const std::string& library_path) {
-        handle = dlopen(library_path.c_str(), RTLD_LAZY);
+
+    // Directories tried (in order) before falling back to the bare name,
+    // which lets dlopen apply its default search (rpath, LD_LIBRARY_PATH)
+    void add_search_path(const std::string& dir) {
+        search_paths_.push_back(dir);
+    }
+
+    bool load(const std::string& library_name, Binding binding = Binding::Lazy) {
+        int flags = binding == Binding::Eager ? (RTLD_NOW | RTLD_GLOBAL)
+                                              : RTLD_LAZY;
+
+        auto dlopen_start = std::chrono::steady_clock::now();
+        std::string resolved = library_name;
+        handle = nullptr;
+        for (const std::string& dir : search_paths_) {
+            std::string candidate = dir + "/" + library_name;
+            handle = dlopen(candidate.c_str(), flags);
+            if (handle) {
+                resolved = candidate;
+                break;
+            }
+        }
+        if (!handle) {
+            handle = dlopen(library_name.c_str(), flags);
+        }
         if (!handle) {
             std::cerr << "Cannot load library: " << dlerror() << std::endl;
             return false;
         }
-        
+        stats_ = LoadStats{};
+        stats_.resolved_path = resolved;
+        stats_.binding = binding;
+        stats_.dlopen_ms = elapsed_ms(dlopen_start);
+
         dlerror(); // Clear any existing error
-        
-        // Note: cxx bridge uses C++ name mangling, so symbols are complex
-        // This is for demonstration - actual symbol names would need inspection via 'nm'
-        
+
+        // cxx mangles its own symbols, so we resolve the stable extern "C"
+        // entry point and pull the whole function-pointer table in one go
+        auto resolve_start = std::chrono::steady_clock::now();
+        auto get_table = reinterpret_cast<get_api_table_fn>(dlsym(handle, "rs_get_api_table"));
+        if (!get_table) {
+            std::cerr << "Cannot resolve rs_get_api_table: " << dlerror() << std::endl;
+            return false;
+        }
+
+        const RsApiTable* table = get_table();
+        if (!table || table->version != RS_API_VERSION) {
+            std::cerr << "API version mismatch: expected " << RS_API_VERSION
+                      << ", library has " << (table ? table->version : 0) << std::endl;
+            return false;
+        }
+
+        api_table = table;
+        stats_.resolve_ms = elapsed_ms(resolve_start);
         return true;
     }
-    
+
+    // Drives one throwaway call through every entry in the table so the
+    // code pages are faulted in (and, under lazy binding, any remaining
+    // stubs are resolved) before the first real request arrives
+    size_t prewarm() {
+        if (!api_table) {
+            return 0;
+        }
+        auto start = std::chrono::steady_clock::now();
+        api_table->calculate_bmi(70.0, 1.75);
+        api_table->greet_person("prewarm");
+        api_table->process_person_batch(nullptr, 0, nullptr);  // no-op pass
+        stats_.prewarmed_entries = 3;
+        stats_.prewarm_ms = elapsed_ms(start);
+        return stats_.prewarmed_entries;
+    }
+
+    const LoadStats& stats() const {
+        return stats_;
+    }
+
     bool is_loaded() const {
         return handle != nullptr;
     }
-    
+
+    // Resolved API table (null until load() succeeds)
+    const RsApiTable* api() const {
+        return api_table;
+    }
+
     static void list_symbols(const std::string& library_path) {
         std::cout << "\nTo inspect library symbols, run:" << std::endl;
         std::cout << "  nm -gU " << library_path << " | c++filt" << std::endl;
     }
 };
 
+// Convenience wrapper for the batched Rust entry point
+// One FFI crossing processes the whole span instead of one crossing per object
+rust::Vec<PersonInfo> process_person_span(const std::vector<const Person*>& persons) {
+    return process_person_batch(persons.data(), persons.size());
+}
+
+// Recycles bridge result structs across calls
+//
+// Paired with the *_into out-parameter functions: a released result
+// keeps its rust::String capacity, so refilling it allocates nothing
+// once the strings have grown to their steady-state size.
+class ResultPool {
+private:
+    std::vector<PersonInfo> person_infos_;
+    std::vector<HealthAnalysis> analyses_;
+
+public:
+    PersonInfo acquire_person_info() {
+        if (person_infos_.empty()) {
+            return PersonInfo();
+        }
+        PersonInfo info = std::move(person_infos_.back());
+        person_infos_.pop_back();
+        return info;
+    }
+
+    void release(PersonInfo&& info) {
+        person_infos_.push_back(std::move(info));
+    }
+
+    HealthAnalysis acquire_analysis() {
+        if (analyses_.empty()) {
+            return HealthAnalysis();
+        }
+        HealthAnalysis analysis = std::move(analyses_.back());
+        analyses_.pop_back();
+        return analysis;
+    }
+
+    void release(HealthAnalysis&& analysis) {
+        analyses_.push_back(std::move(analysis));
+    }
+
+    size_t pooled_count() const {
+        return person_infos_.size() + analyses_.size();
+    }
+};
+
+// Reconstruct a string_view over the C++ storage a zero-copy result
+// points into (valid while the Person is alive and unmodified)
+std::string_view city_view(const PersonInfoView& info) {
+    return std::string_view(reinterpret_cast<const char*>(info.city_ptr), info.city_len);
+}
+
+// View over a fixed inline string from a compact result; a len of 0xFF
+// marks truncation, in which case the 24-byte prefix is shown
+std::string_view inline_str(const InlineStr24& s) {
+    return std::string_view(reinterpret_cast<const char*>(s.bytes.data()),
+                            s.len == 0xFF ? s.bytes.size() : s.len);
+}
+
 // Helper function to print PersonInfo results from Rust
 void print_person_info(const PersonInfo& info, const std::string& name) {
     std::cout << "\n=== Person Information (from Rust analysis) ===" << std::endl;
@@ -181,7 +423,438 @@ int main() {
     std::cout << "\n--- Example 9: Using Factory Functions ---" << std::endl;
     auto addr3 = create_address("789 Pine Rd", "San Francisco", "94102");
     std::cout << "Created address: " << addr3->city() << std::endl;
+
+    // Example 10: Batched processing - one FFI crossing for many objects
+    std::cout << "\n--- Example 10: Batched Processing (Single FFI Crossing) ---" << std::endl;
+    std::vector<const Person*> batch = {person1.get(), person2.get(), person3.get()};
+    rust::Vec<PersonInfo> batch_results = process_person_span(batch);
+    std::cout << "Processed " << batch_results.size()
+              << " persons with one process_person_batch call" << std::endl;
+    for (size_t i = 0; i < batch_results.size(); ++i) {
+        std::cout << "  [" << i << "] city=" << std::string(batch_results[i].city)
+                  << ", adult=" << (batch_results[i].is_adult ? "yes" : "no") << std::endl;
+    }
+
+    // Example 11: Snapshot-based processing - one crossing instead of seven
+    std::cout << "\n--- Example 11: Snapshot Processing (O(1) Crossings) ---" << std::endl;
+    PersonInfo snap_info = process_person_snapshot(*person1);
+    std::cout << "process_person_snapshot read all fields in one crossing: city="
+              << std::string(snap_info.city)
+              << ", name_length=" << snap_info.name_length << std::endl;
+
+    // Example 12: Columnar analysis - structure-of-arrays batch
+    std::cout << "\n--- Example 12: Columnar Analysis (Structure of Arrays) ---" << std::endl;
+    PersonColumnBatch columns;
+    columns.push_person(*person1, 75.0);
+    columns.push_person(*person2, 55.0);
+    columns.push_person(*person3, 80.0);
+    HealthColumns column_results = analyze_health_columns(columns);
+    std::cout << "Analyzed " << column_results.bmis.size()
+              << " rows over contiguous columns ("
+              << columns.city_count() << " distinct cities interned)" << std::endl;
+    for (size_t i = 0; i < column_results.bmis.size(); ++i) {
+        std::cout << "  [" << i << "] BMI=" << column_results.bmis[i]
+                  << ", risk=" << column_results.risk_scores[i] << std::endl;
+    }
     
+    // Example 13: City interning - dense ids instead of per-record strings
+    std::cout << "\n--- Example 13: City Interning Dictionary ---" << std::endl;
+    PersonInfoInterned interned1 = process_person_interned(*person1);
+    PersonInfoInterned interned2 = process_person_interned(*person2);
+    std::cout << "Dictionary holds " << city_dictionary_size()
+              << " cities after interning" << std::endl;
+    std::cout << "  " << person1->name() << ": city_id=" << interned1.city_id
+              << " (" << city_dictionary_name(interned1.city_id) << ")"
+              << ", risk factor=" << city_risk_by_id(interned1.city_id) << std::endl;
+    std::cout << "  " << person2->name() << ": city_id=" << interned2.city_id
+              << " (" << city_dictionary_name(interned2.city_id) << ")"
+              << ", risk factor=" << city_risk_by_id(interned2.city_id) << std::endl;
+
+    // Example 14: Arena-allocated person graphs - bulk construction and free
+    std::cout << "\n--- Example 14: Arena-Allocated Person Graphs ---" << std::endl;
+    PersonArena arena;
+    Person* arena_person = create_person(
+        arena, 42, 1.82, "Dana Arena",
+        create_contact_info(arena, "dana@example.com", "555-9012",
+                            create_address(arena, "12 Arena Way", "New York", "10002")));
+    PersonInfo arena_info = process_person(*arena_person);
+    std::cout << "Arena person processed by Rust: city="
+              << std::string(arena_info.city) << std::endl;
+    std::cout << "Arena holds " << arena.object_count() << " objects in "
+              << arena.chunk_count() << " chunk(s)" << std::endl;
+    arena.reset();  // bulk-free the whole epoch in one call
+    std::cout << "After reset: " << arena.object_count()
+              << " objects (chunks retained for reuse)" << std::endl;
+
+    // Example 15: Zero-copy view results - no allocation, no string copy
+    std::cout << "\n--- Example 15: Zero-Copy View Results ---" << std::endl;
+    PersonInfoView view_info = process_person_view(*person1);
+    std::cout << "City via pointer+length view (no copy): "
+              << city_view(view_info) << std::endl;
+    HealthAnalysisView view_health = analyze_health_view(*person1, 75.0);
+    std::cout << "Recommendation via canonical table id "
+              << static_cast<int>(view_health.recommendation_id) << ": "
+              << std::string(recommendation_text(view_health.recommendation_id)) << std::endl;
+
+    // Example 16: Memory-mapped record file - streaming analysis
+    std::cout << "\n--- Example 16: Memory-Mapped Record File ---" << std::endl;
+    const std::string record_path = "/tmp/persons.prsn";
+    PersonFileWriter writer;
+    writer.add_person(*person1, 75.0);
+    writer.add_person(*person2, 55.0);
+    writer.add_person(*person3, 80.0);
+    if (writer.write(record_path)) {
+        PersonFile record_file;
+        if (record_file.open(record_path)) {
+            std::cout << "Mapped " << record_file.size_bytes() << " bytes, "
+                      << record_file.record_count() << " flat records" << std::endl;
+            HealthColumns file_results = analyze_health_file(record_file);
+            for (size_t i = 0; i < file_results.bmis.size(); ++i) {
+                std::cout << "  [" << i << "] BMI=" << file_results.bmis[i]
+                          << ", risk=" << file_results.risk_scores[i] << std::endl;
+            }
+        }
+        std::remove(record_path.c_str());
+    }
+
+    // Example 17: Parallel analysis - one crossing, all cores
+    std::cout << "\n--- Example 17: Parallel Analysis (rayon) ---" << std::endl;
+    set_analysis_threads(4);
+    std::vector<double> batch_weights = {75.0, 55.0, 80.0};
+    rust::Vec<HealthAnalysis> parallel_results = analyze_health_parallel(
+        batch.data(), batch.size(),
+        rust::Slice<const double>(batch_weights.data(), batch_weights.size()));
+    std::cout << "Analyzed " << parallel_results.size()
+              << " persons across a 4-thread Rust pool in one crossing" << std::endl;
+    for (size_t i = 0; i < parallel_results.size(); ++i) {
+        std::cout << "  [" << i << "] risk=" << parallel_results[i].risk_score << std::endl;
+    }
+
+    // Example 18: Result pooling - refill the same structs, reuse capacity
+    std::cout << "\n--- Example 18: Result Pooling (Out-Parameter API) ---" << std::endl;
+    ResultPool result_pool;
+    PersonInfo pooled_info = result_pool.acquire_person_info();
+    HealthAnalysis pooled_analysis = result_pool.acquire_analysis();
+    for (const auto& person : {person1.get(), person2.get()}) {
+        process_person_into(*person, pooled_info);
+        analyze_health_into(*person, 70.0, pooled_analysis);
+        std::cout << "  " << person->name() << ": city="
+                  << std::string(pooled_info.city)
+                  << ", risk=" << pooled_analysis.risk_score << std::endl;
+    }
+    result_pool.release(std::move(pooled_info));
+    result_pool.release(std::move(pooled_analysis));
+    std::cout << "Pool holds " << result_pool.pooled_count()
+              << " recycled results (string capacity retained)" << std::endl;
+
+    // Example 19: Detailed validation - failure bitmask instead of bool
+    std::cout << "\n--- Example 19: Validation Bitmask Fast Path ---" << std::endl;
+    std::vector<const ContactInfo*> contacts = {
+        &person1->contact(), &person2->contact(), &person3->contact()};
+    rust::Vec<uint32_t> masks = validate_contact_batch(contacts.data(), contacts.size());
+    const char* rule_names[] = {"email", "phone", "city", "postal"};
+    const Person* mask_persons[] = {person1.get(), person2.get(), person3.get()};
+    for (size_t i = 0; i < masks.size(); ++i) {
+        std::cout << "  " << mask_persons[i]->name() << ": ";
+        if (masks[i] == 0) {
+            std::cout << "valid" << std::endl;
+            continue;
+        }
+        std::cout << "failed:";
+        for (int bit = 0; bit < 4; ++bit) {
+            if (masks[i] & (1u << bit)) {
+                std::cout << " " << rule_names[bit];
+            }
+        }
+        std::cout << std::endl;
+    }
+
+    // Example 20: Bridge instrumentation (zeros unless built with
+    // -DFFI_BRIDGE_STATS=ON / cargo feature bridge-stats)
+    std::cout << "\n--- Example 20: Bridge Instrumentation ---" << std::endl;
+    reset_bridge_stats();
+    process_person(*person1);
+    analyze_health(*person1, 75.0);
+    validate_contact(person1->contact());
+    BridgeStats stats = get_bridge_stats();
+    if (stats.crossings == 0) {
+        std::cout << "Instrumentation compiled out (configure with "
+                  << "-DFFI_BRIDGE_STATS=ON to enable)" << std::endl;
+    } else {
+        std::cout << "3 analysis calls cost " << stats.crossings
+                  << " crossings, " << stats.entry_cycles << " entry cycles, "
+                  << stats.string_bytes << " string bytes copied" << std::endl;
+    }
+
+    // Example 21: Lazy field extraction - skip the cache-hostile traversal
+    std::cout << "\n--- Example 21: Lazy Field Extraction ---" << std::endl;
+    // Bits: 1=is_adult, 2=bmi_category, 4=name_length, 8=city
+    PersonInfo cheap_info = process_person_fields(*person1, 0x3);
+    std::cout << "Mask 0x3 (adult+bmi only): adult="
+              << (cheap_info.is_adult ? "yes" : "no")
+              << ", bmi_category=" << static_cast<int>(cheap_info.bmi_category)
+              << ", city=\"" << std::string(cheap_info.city)
+              << "\" (never fetched)" << std::endl;
+    PersonInfo full_info = process_person_fields(*person1, 0xF);
+    std::cout << "Mask 0xF (everything): city=\"" << std::string(full_info.city)
+              << "\"" << std::endl;
+
+    // Example 22: Compact POD results - the city is stored inline, so a
+    // batch returns one flat buffer with zero per-element allocations
+    std::cout << "\n--- Example 22: Compact Inline-String Results ---" << std::endl;
+    PersonInfoCompact compact = process_person_compact(*person1);
+    std::cout << "Compact result: city=\"" << inline_str(compact.city)
+              << "\" (inline, " << static_cast<int>(compact.city.len)
+              << " bytes), adult=" << (compact.is_adult ? "yes" : "no")
+              << ", overflowed="
+              << (inline_str_overflowed(compact.city) ? "yes" : "no")
+              << std::endl;
+    std::vector<const Person*> compact_batch = {person1.get(), person2.get(),
+                                                person3.get()};
+    rust::Vec<PersonInfoCompact> compact_results =
+        process_person_batch_compact(compact_batch.data(), compact_batch.size());
+    std::cout << "Batch of " << compact_results.size()
+              << " PODs in one flat buffer ("
+              << sizeof(PersonInfoCompact) << " bytes each):" << std::endl;
+    for (const auto& c : compact_results) {
+        std::cout << "  " << inline_str(c.city)
+                  << " / bmi_category=" << static_cast<int>(c.bmi_category)
+                  << std::endl;
+    }
+
+    // Example 23: Loadable city-risk index - swap the builtin 3-city
+    // table for a file-backed index built once, queried in O(1)
+    std::cout << "\n--- Example 23: Loadable City-Risk Index ---" << std::endl;
+    std::cout << "Risk for New York (builtin table): "
+              << analyze_health(*person1, 70.0).city_risk_factor << std::endl;
+    const std::string risk_path = "/tmp/city_risk.csv";
+    {
+        std::ofstream risk_file(risk_path);
+        risk_file << "# locality risk factors\n"
+                  << "New York,1.35\n"
+                  << "Boston,1.08\n"
+                  << "Springfield,0.95\n";
+    }
+    size_t risk_entries = load_city_risk_table(risk_path);
+    std::cout << "Loaded " << risk_entries << " entries from " << risk_path
+              << " (index size: " << city_risk_table_size() << ")" << std::endl;
+    std::cout << "Risk for New York (loaded index):  "
+              << analyze_health(*person1, 70.0).city_risk_factor << std::endl;
+
+    // Example 24: Async submission - enqueue analyses without blocking
+    // the calling thread, then await completions through an eventfd the
+    // way a reactor would await any other readiness event
+    std::cout << "\n--- Example 24: Async Analysis Submission ---" << std::endl;
+    int completion_fd = -1;
+#if defined(__linux__)
+    completion_fd = eventfd(0, 0);
+    if (completion_fd >= 0) {
+        analysis_set_event_fd(completion_fd);
+    }
+#endif
+    uint64_t ticket1 = analysis_submit(snapshot_person(*person1), 70.0);
+    uint64_t ticket2 = analysis_submit(snapshot_person(*person2), 55.0);
+    uint64_t ticket3 = analysis_submit(snapshot_person(*person3), 80.0);
+    std::cout << "Submitted tickets " << ticket1 << ", " << ticket2 << ", "
+              << ticket3 << " without blocking (pending: "
+              << analysis_pending() << ")" << std::endl;
+    size_t collected = 0;
+    while (collected < 3) {
+        if (completion_fd >= 0) {
+#if defined(__linux__)
+            // Blocks until a worker bumps the counter - in a real
+            // service this fd would sit in the epoll/io_uring set
+            uint64_t wakeups = 0;
+            if (read(completion_fd, &wakeups, sizeof(wakeups)) < 0) {
+                break;
+            }
+#endif
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        for (const AnalysisCompletion& done : analysis_poll_completions()) {
+            std::cout << "  ticket " << done.ticket
+                      << " completed: risk=" << done.analysis.risk_score
+                      << std::endl;
+            ++collected;
+        }
+    }
+    analysis_set_event_fd(-1);
+#if defined(__linux__)
+    if (completion_fd >= 0) {
+        close(completion_fd);
+    }
+#endif
+
+    // Example 25: Move-semantics construction - the six strings of a
+    // record are adopted, not copied, through the whole graph
+    std::cout << "\n--- Example 25: Move-Semantics Construction ---" << std::endl;
+    std::string ingest_name = "Dana Moved";
+    std::string ingest_city = "Chicago";
+    auto moved_person = emplace_person(41, 1.68, std::move(ingest_name),
+                                       "dana@example.com", "555-9876",
+                                       "12 Move Lane", std::move(ingest_city),
+                                       "60601");
+    std::cout << "Built " << moved_person->name() << " of "
+              << moved_person->contact().address().city()
+              << " with zero string copies (moved-from name now \""
+              << ingest_name << "\")" << std::endl;
+
+    // Example 26: Compact single-allocation Person - the whole graph in
+    // one block, read through the unchanged bridge
+    std::cout << "\n--- Example 26: Compact Person Layout ---" << std::endl;
+    std::shared_ptr<Person> compact_person = make_compact_person(
+        52, 1.72, "Erin Flat", "erin@example.com", "555-2468",
+        "7 Cache Line Ct", "Boston", "02102");
+    PersonInfo compact_person_info = process_person(*compact_person);
+    std::cout << "One allocation holds Person+ContactInfo+Address ("
+              << sizeof(Person) + sizeof(ContactInfo) + sizeof(Address)
+              << " bytes of objects); bridge sees city \""
+              << std::string(compact_person_info.city) << "\" as usual"
+              << std::endl;
+
+    // Example 27: Bulk SIMD-style kernels - whole columns per crossing
+    // instead of one bridge call per divide
+    std::cout << "\n--- Example 27: Bulk BMI/Risk Kernels ---" << std::endl;
+    std::vector<double> kernel_weights = {70.0, 80.0, 60.0, 55.0, 90.0};
+    std::vector<double> kernel_heights = {1.75, 1.80, 1.60, 1.65, 1.90};
+    std::vector<uint32_t> kernel_ages = {30, 70, 16, 45, 25};
+    std::vector<double> kernel_bmis(kernel_weights.size());
+    std::vector<double> kernel_city_risks(kernel_weights.size(), 1.0);
+    std::vector<double> kernel_risks(kernel_weights.size());
+    size_t bmi_rows = calculate_bmi_bulk(
+        rust::Slice<const double>(kernel_weights.data(), kernel_weights.size()),
+        rust::Slice<const double>(kernel_heights.data(), kernel_heights.size()),
+        rust::Slice<double>(kernel_bmis.data(), kernel_bmis.size()));
+    size_t risk_rows = risk_score_bulk(
+        rust::Slice<const uint32_t>(kernel_ages.data(), kernel_ages.size()),
+        rust::Slice<const double>(kernel_bmis.data(), kernel_bmis.size()),
+        rust::Slice<const double>(kernel_city_risks.data(),
+                                  kernel_city_risks.size()),
+        rust::Slice<double>(kernel_risks.data(), kernel_risks.size()));
+    std::cout << "Two crossings filled " << bmi_rows << " BMIs and "
+              << risk_rows << " risk scores; first row bmi="
+              << kernel_bmis[0] << " risk=" << kernel_risks[0]
+              << ", second row risk=" << kernel_risks[1] << std::endl;
+
+    // Example 28: Incremental recomputation - edit one field, refresh
+    // only the outputs it feeds
+    std::cout << "\n--- Example 28: Dirty-Field Refresh ---" << std::endl;
+    auto edit_person = emplace_person(40, 1.80, "Frank Delta",
+                                      "frank@example.com", "555-1357",
+                                      "3 Update Way", "New York", "10001");
+    HealthAnalysis base_analysis = analyze_health(*edit_person, 75.0);
+    edit_person->clear_dirty();
+    edit_person->set_height(1.65);
+    uint32_t dirty = edit_person->dirty_mask();
+    HealthAnalysis refreshed =
+        refresh_analysis(*edit_person, base_analysis, 75.0, dirty);
+    edit_person->clear_dirty();
+    std::cout << "Height edit (dirty mask 0x" << std::hex << dirty << std::dec
+              << "): bmi " << base_analysis.bmi << " -> " << refreshed.bmi
+              << ", risk " << base_analysis.risk_score << " -> "
+              << refreshed.risk_score
+              << " (city lookup skipped, risk factor carried over: "
+              << refreshed.city_risk_factor << ")" << std::endl;
+
+    // Example 29: Warm-start cache - clustered inputs answer from a
+    // memo table instead of recomputing risk per record
+    std::cout << "\n--- Example 29: Warm-Start Analysis Cache ---" << std::endl;
+    std::cout << "Cache capacity: " << set_analysis_cache_capacity(1024)
+              << std::endl;
+    for (int repeat = 0; repeat < 5; ++repeat) {
+        analyze_health_cached(*person1, 70.0); // same key every time
+    }
+    HealthAnalysis cached = analyze_health_cached(*person2, 55.0);
+    std::cout << "person1 x5 + person2 x1: hits=" << analysis_cache_hits()
+              << " misses=" << analysis_cache_misses() << " (person2 risk "
+              << cached.risk_score << ")" << std::endl;
+    set_analysis_cache_capacity(0); // back to uncached default
+
+    // Example 30: Freeze/publish + sharded registry - concurrent reads
+    // with no per-Person mutex
+    std::cout << "\n--- Example 30: Frozen Persons and Registry ---" << std::endl;
+    PersonRegistry& registry = PersonRegistry::instance();
+    const char* kRegistryCities[4] = {"New York", "Los Angeles", "Boston",
+                                      "Chicago"};
+    for (uint64_t record_id = 1; record_id <= 64; ++record_id) {
+        registry.publish(record_id,
+                         freeze_person(emplace_person(
+                             static_cast<uint32_t>(20 + record_id % 50), 1.70,
+                             "Registry Person", "r@example.com", "555-0000",
+                             "9 Shard St", kRegistryCities[record_id % 4],
+                             "10001")));
+    }
+    std::atomic<size_t> adults{0};
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < 4; ++reader) {
+        readers.emplace_back([&registry, &adults] {
+            for (uint64_t record_id = 1; record_id <= 64; ++record_id) {
+                // Lock-free read path: the frozen handle guarantees no
+                // writer exists, so process_person needs no mutex
+                FrozenPerson frozen = registry.find(record_id);
+                if (frozen && process_person(*frozen).is_adult) {
+                    adults.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    std::cout << registry.size() << " published records, 4 readers x 64"
+              << " lookups, " << adults.load() << " adult results, zero"
+              << " defensive locks" << std::endl;
+
+    // Example 31: Packed batch validation - the whole batch's fields in
+    // one buffer, scanned in one crossing
+    std::cout << "\n--- Example 31: Packed Batch Validation ---" << std::endl;
+    ContactBatch contact_pack;
+    contact_pack.push_contact(*contact1);
+    contact_pack.push_contact(*contact2);
+    contact_pack.push_contact(*bad_contact);
+    rust::Vec<uint32_t> packed_masks = validate_contact_packed(
+        rust::Slice<const uint8_t>(
+            reinterpret_cast<const uint8_t*>(contact_pack.bytes().data()),
+            contact_pack.bytes().size()),
+        rust::Slice<const uint32_t>(contact_pack.offsets().data(),
+                                    contact_pack.offsets().size()));
+    std::cout << contact_pack.size() << " contacts, "
+              << contact_pack.bytes().size()
+              << " packed bytes, one crossing; masks:";
+    for (uint32_t mask : packed_masks) {
+        std::cout << " 0x" << std::hex << mask << std::dec;
+    }
+    std::cout << " (bit0=email bit1=phone bit2=city bit3=postal)"
+              << std::endl;
+
+#ifdef FFI_ALLOC_STATS
+    // Allocation scorecard - per-call heap deltas for the main bridge
+    // entry points, making the zero-alloc-per-record goal checkable at
+    // a glance (build with -DFFI_ALLOC_STATS=ON)
+    std::cout << "\n--- Allocation Scorecard (heap delta per call) ---"
+              << std::endl;
+    print_alloc_row("process_person", measure_allocs([&] {
+        process_person(*person1);
+    }));
+    print_alloc_row("process_person_snapshot", measure_allocs([&] {
+        process_person_snapshot(*person1);
+    }));
+    print_alloc_row("process_person_interned", measure_allocs([&] {
+        process_person_interned(*person1);
+    }));
+    print_alloc_row("process_person_compact", measure_allocs([&] {
+        process_person_compact(*person1);
+    }));
+    print_alloc_row("analyze_health", measure_allocs([&] {
+        analyze_health(*person1, 70.0);
+    }));
+    PersonInfo warm_info = process_person(*person1);
+    print_alloc_row("process_person_into (warm)", measure_allocs([&] {
+        process_person_into(*person1, warm_info);
+    }));
+#endif
+
     std::cout << "\n✅ Demo completed successfully!" << std::endl;
     std::cout << "\n╔══════════════════════════════════════════════════════════╗" << std::endl;
     std::cout << "║         Key Integration Patterns Demonstrated            ║" << std::endl;
@@ -225,32 +898,64 @@ int main() {
     std::cout << "The above examples used compile-time linking (static or dynamic)." << std::endl;
     std::cout << "Now demonstrating runtime loading with dlopen...\n" << std::endl;
     
-    // Determine library path based on platform
+    // Determine library name based on platform; the loader's search
+    // paths decide where it is actually found
     #ifdef __APPLE__
-        std::string lib_path = "rust-lib/target/release/librust_lib.dylib";
+        std::string lib_name = "librust_lib.dylib";
     #elif defined(_WIN32)
-        std::string lib_path = "rust-lib/target/release/rust_lib.dll";
+        std::string lib_name = "rust_lib.dll";
     #else
-        std::string lib_path = "rust-lib/target/release/librust_lib.so";
+        std::string lib_name = "librust_lib.so";
     #endif
-    
+
     DynamicRustLibrary dynamic_lib;
-    std::cout << "Attempting runtime load: " << lib_path << std::endl;
-    
-    if (dynamic_lib.load(lib_path)) {
+    dynamic_lib.add_search_path("rust-lib/target/release");
+    dynamic_lib.add_search_path(".");
+    std::cout << "Attempting runtime load: " << lib_name
+              << " (eager binding)" << std::endl;
+
+    // Eager binding + prewarm: all relocation and page-fault cost is paid
+    // here, at swap time, instead of surfacing in the first real request
+    if (dynamic_lib.load(lib_name, DynamicRustLibrary::Binding::Eager)) {
         std::cout << "✓ Library loaded at runtime successfully!" << std::endl;
-        
+        size_t warmed = dynamic_lib.prewarm();
+
+        const auto& load_stats = dynamic_lib.stats();
+        std::cout << "  Resolved path: " << load_stats.resolved_path << std::endl;
+        std::cout << "  Load phases: dlopen " << load_stats.dlopen_ms
+                  << " ms (RTLD_NOW | RTLD_GLOBAL), resolve "
+                  << load_stats.resolve_ms << " ms, prewarm "
+                  << load_stats.prewarm_ms << " ms (" << warmed
+                  << " entries)" << std::endl;
+
+        // Call through the resolved extern "C" table
+        const RsApiTable* api = dynamic_lib.api();
+        std::cout << "✓ Resolved rs_get_api_table (API version "
+                  << api->version << ")" << std::endl;
+        std::cout << "  calculate_bmi via dlopen'd table: "
+                  << api->calculate_bmi(70.0, 1.75) << std::endl;
+
+        RsPersonInfo dyn_results[2];
+        const Person* dyn_batch[2] = {person1.get(), person2.get()};
+        size_t processed = api->process_person_batch(dyn_batch, 2, dyn_results);
+        std::cout << "  process_person_batch via table processed "
+                  << processed << " persons; first city_id="
+                  << dyn_results[0].city_id << std::endl;
+
         std::cout << "\n📝 Notes on Runtime Loading:" << std::endl;
         std::cout << "  • The library is loaded AFTER the program starts" << std::endl;
         std::cout << "  • Useful for plugin architectures" << std::endl;
-        std::cout << "  • Challenge: cxx bridge uses C++ name mangling" << std::endl;
-        std::cout << "  • Solution: Add extern \"C\" wrappers in Rust" << std::endl;
-        
-        DynamicRustLibrary::list_symbols(lib_path);
-        
+        std::cout << "  • cxx mangles its symbols, so we export a stable" << std::endl;
+        std::cout << "    extern \"C\" vtable (rs_get_api_table) instead" << std::endl;
+        std::cout << "  • Eager binding + prewarm make first-request latency" << std::endl;
+        std::cout << "    deterministic after a library swap" << std::endl;
+
+        DynamicRustLibrary::list_symbols(dynamic_lib.stats().resolved_path);
+
     } else {
-        std::cout << "ℹ Runtime loading failed (this is expected)" << std::endl;
-        std::cout << "  Current demo uses compile-time linking instead." << std::endl;
+        std::cout << "ℹ Runtime loading failed" << std::endl;
+        std::cout << "  The cdylib is built alongside the staticlib; check that" << std::endl;
+        std::cout << "  " << lib_name << " is on the loader's search path." << std::endl;
         std::cout << "  See DYNAMIC_LINKING.md for runtime loading details." << std::endl;
     }
     
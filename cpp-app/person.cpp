@@ -1,5 +1,11 @@
 #include "person.h"
 
+// cxx-generated header - needed for the PersonSnapshot bridge struct
+#include "rust-lib/src/lib.rs.h"
+
+#include <memory>
+#include <new>
+
 // Factory function implementations
 
 std::unique_ptr<Address> create_address(const std::string& street, 
@@ -21,45 +27,322 @@ std::unique_ptr<Person> create_person(uint32_t age,
     return std::make_unique<Person>(age, height, name, contact);
 }
 
-// Getter function implementations for FFI
+// Move overloads - forward the rvalues straight into the move
+// constructors so the caller's buffers are adopted, never copied
+
+std::unique_ptr<Address> create_address(std::string&& street,
+                                        std::string&& city,
+                                        std::string&& postal_code) {
+    return std::make_unique<Address>(std::move(street), std::move(city),
+                                     std::move(postal_code));
+}
+
+std::unique_ptr<ContactInfo> create_contact_info(std::string&& email,
+                                                 std::string&& phone,
+                                                 std::shared_ptr<Address> address) {
+    return std::make_unique<ContactInfo>(std::move(email), std::move(phone),
+                                         std::move(address));
+}
+
+std::unique_ptr<Person> create_person(uint32_t age,
+                                      double height,
+                                      std::string&& name,
+                                      std::shared_ptr<ContactInfo> contact) {
+    return std::make_unique<Person>(age, height, std::move(name),
+                                    std::move(contact));
+}
+
+std::unique_ptr<Person> emplace_person(uint32_t age,
+                                       double height,
+                                       std::string name,
+                                       std::string email,
+                                       std::string phone,
+                                       std::string street,
+                                       std::string city,
+                                       std::string postal_code) {
+    auto address = std::make_shared<Address>(std::move(street), std::move(city),
+                                             std::move(postal_code));
+    auto contact = std::make_shared<ContactInfo>(std::move(email), std::move(phone),
+                                                 std::move(address));
+    return std::make_unique<Person>(age, height, std::move(name),
+                                    std::move(contact));
+}
+
+namespace {
+
+// One contiguous block holding the full graph for make_compact_person.
+// Member order doubles as construction order: the Address exists before
+// the ContactInfo takes a non-owning pointer to it, and likewise for
+// the Person; destruction runs in reverse automatically.
+struct CompactPersonBlock {
+    Address address;
+    ContactInfo contact;
+    Person person;
+
+    CompactPersonBlock(uint32_t age, double height, std::string name,
+                       std::string email, std::string phone,
+                       std::string street, std::string city,
+                       std::string postal_code)
+        : address(std::move(street), std::move(city), std::move(postal_code)),
+          contact(std::move(email), std::move(phone),
+                  std::shared_ptr<Address>(std::shared_ptr<void>(), &address)),
+          person(age, height, std::move(name),
+                 std::shared_ptr<ContactInfo>(std::shared_ptr<void>(), &contact)) {}
+};
+
+}  // namespace
+
+std::shared_ptr<Person> make_compact_person(uint32_t age,
+                                            double height,
+                                            std::string name,
+                                            std::string email,
+                                            std::string phone,
+                                            std::string street,
+                                            std::string city,
+                                            std::string postal_code) {
+    // make_shared puts block and control block in a single allocation
+    auto block = std::make_shared<CompactPersonBlock>(
+        age, height, std::move(name), std::move(email), std::move(phone),
+        std::move(street), std::move(city), std::move(postal_code));
+    Person* person = &block->person;
+    // Aliasing handle: owns the whole block, points at the Person inside
+    return std::shared_ptr<Person>(std::move(block), person);
+}
+
+// The getter shims for Rust FFI live inline in person.h so that LTO can
+// collapse each Rust -> C++ field read into a direct member load
+
+// Bridge instrumentation counters (see person.h for the shim macros)
+
+#ifdef FFI_BRIDGE_STATS
+BridgeStatsCounters& bridge_stats_counters() {
+    static thread_local BridgeStatsCounters counters;
+    return counters;
+}
+
+uint64_t bridge_getter_crossings() {
+    return bridge_stats_counters().getter_crossings;
+}
+
+uint64_t bridge_string_bytes() {
+    return bridge_stats_counters().string_bytes;
+}
+
+void reset_bridge_getter_stats() {
+    bridge_stats_counters() = BridgeStatsCounters{};
+}
+#else
+uint64_t bridge_getter_crossings() {
+    return 0;
+}
+
+uint64_t bridge_string_bytes() {
+    return 0;
+}
+
+void reset_bridge_getter_stats() {}
+#endif
+
+// PersonRegistry implementation
+
+void PersonRegistry::publish(uint64_t id, FrozenPerson person) {
+    Shard& shard = shards_[shard_for(id)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    shard.persons[id] = std::move(person);
+}
+
+FrozenPerson PersonRegistry::find(uint64_t id) const {
+    const Shard& shard = shards_[shard_for(id)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.persons.find(id);
+    return it != shard.persons.end() ? it->second : nullptr;
+}
+
+bool PersonRegistry::erase(uint64_t id) {
+    Shard& shard = shards_[shard_for(id)];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.persons.erase(id) != 0;
+}
+
+size_t PersonRegistry::size() const {
+    size_t total = 0;
+    for (const Shard& shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        total += shard.persons.size();
+    }
+    return total;
+}
+
+// PersonArena implementation
 
-uint32_t get_person_age(const Person& person) {
-    return person.age();
+PersonArena::PersonArena(size_t chunk_size)
+    : chunk_size_(chunk_size), chunk_index_(0), offset_(0), object_count_(0) {
+    chunks_.push_back(std::make_unique<char[]>(chunk_size_));
 }
 
-double get_person_height(const Person& person) {
-    return person.height();
+PersonArena::~PersonArena() {
+    reset();
 }
 
-const std::string& get_person_name(const Person& person) {
-    return person.name();
+void* PersonArena::allocate(size_t size, size_t align) {
+    // Bump-allocate from the current chunk, moving to the next (or a new)
+    // chunk when the aligned request no longer fits
+    for (;;) {
+        char* base = chunks_[chunk_index_].get();
+        size_t aligned = (offset_ + align - 1) & ~(align - 1);
+        if (aligned + size <= chunk_size_) {
+            offset_ = aligned + size;
+            return base + aligned;
+        }
+        ++chunk_index_;
+        offset_ = 0;
+        if (chunk_index_ == chunks_.size()) {
+            chunks_.push_back(std::make_unique<char[]>(chunk_size_));
+        }
+    }
 }
 
-const ContactInfo& get_person_contact(const Person& person) {
-    return person.contact();
+Address* PersonArena::create_address(const std::string& street,
+                                     const std::string& city,
+                                     const std::string& postal_code) {
+    return create<Address>(street, city, postal_code);
 }
 
-const std::string& get_contact_email(const ContactInfo& contact) {
-    return contact.email();
+ContactInfo* PersonArena::create_contact_info(const std::string& email,
+                                              const std::string& phone,
+                                              Address* address) {
+    // Non-owning shared_ptr (aliasing constructor with an empty owner):
+    // the arena owns the Address, so no control block is allocated
+    return create<ContactInfo>(email, phone,
+                               std::shared_ptr<Address>(std::shared_ptr<void>(), address));
 }
 
-const std::string& get_contact_phone(const ContactInfo& contact) {
-    return contact.phone();
+Person* PersonArena::create_person(uint32_t age,
+                                   double height,
+                                   const std::string& name,
+                                   ContactInfo* contact) {
+    return create<Person>(age, height, name,
+                          std::shared_ptr<ContactInfo>(std::shared_ptr<void>(), contact));
 }
 
-const Address& get_contact_address(const ContactInfo& contact) {
-    return contact.address();
+void PersonArena::reset() {
+    // Destroy in reverse construction order, then rewind the bump pointer;
+    // chunks are kept so the next epoch reuses the same memory
+    for (auto it = finalizers_.rbegin(); it != finalizers_.rend(); ++it) {
+        it->destroy(it->object);
+    }
+    finalizers_.clear();
+    chunk_index_ = 0;
+    offset_ = 0;
+    object_count_ = 0;
 }
 
-const std::string& get_address_street(const Address& address) {
-    return address.street();
+// Arena-backed factory overloads
+
+Address* create_address(PersonArena& arena,
+                        const std::string& street,
+                        const std::string& city,
+                        const std::string& postal_code) {
+    return arena.create_address(street, city, postal_code);
+}
+
+ContactInfo* create_contact_info(PersonArena& arena,
+                                 const std::string& email,
+                                 const std::string& phone,
+                                 Address* address) {
+    return arena.create_contact_info(email, phone, address);
 }
 
-const std::string& get_address_city(const Address& address) {
-    return address.city();
+Person* create_person(PersonArena& arena,
+                      uint32_t age,
+                      double height,
+                      const std::string& name,
+                      ContactInfo* contact) {
+    return arena.create_person(age, height, name, contact);
 }
 
-const std::string& get_address_postal_code(const Address& address) {
-    return address.postal_code();
+// City dictionary bridge implementations
+// All callers share the process-wide CityDictionary instance
+
+uint32_t intern_city(const std::string& city) {
+    return CityDictionary::instance().intern(city);
+}
+
+const std::string& city_dictionary_name(uint32_t id) {
+    return CityDictionary::instance().name(id);
+}
+
+size_t city_dictionary_size() {
+    return CityDictionary::instance().size();
+}
+
+// PersonColumnBatch implementation
+
+void PersonColumnBatch::push_person(const Person& person, double weight_kg) {
+    const std::string& city = person.contact().address().city();
+
+    // Intern the city name to a dense id (linear scan is fine for the
+    // handful of distinct cities a batch typically contains)
+    uint32_t city_id = 0;
+    for (; city_id < cities_.size(); ++city_id) {
+        if (cities_[city_id] == city) break;
+    }
+    if (city_id == cities_.size()) {
+        cities_.push_back(city);
+    }
+
+    ages_.push_back(person.age());
+    heights_.push_back(person.height());
+    weights_.push_back(weight_kg);
+    city_ids_.push_back(city_id);
+}
+
+// Column accessor implementations for FFI
+
+size_t batch_size(const PersonColumnBatch& batch) {
+    return batch.size();
+}
+
+const uint32_t* batch_ages_ptr(const PersonColumnBatch& batch) {
+    return batch.ages().data();
+}
+
+const double* batch_heights_ptr(const PersonColumnBatch& batch) {
+    return batch.heights().data();
+}
+
+const double* batch_weights_ptr(const PersonColumnBatch& batch) {
+    return batch.weights().data();
+}
+
+const uint32_t* batch_city_ids_ptr(const PersonColumnBatch& batch) {
+    return batch.city_ids().data();
+}
+
+size_t batch_city_count(const PersonColumnBatch& batch) {
+    return batch.city_count();
+}
+
+const std::string& batch_city_name(const PersonColumnBatch& batch, uint32_t id) {
+    return batch.city_name(id);
+}
+
+// Snapshot function for FFI
+// Copies every field Rust cares about into one flat bridge struct,
+// so a single crossing replaces the per-field getter round-trips
+
+PersonSnapshot snapshot_person(const Person& person) {
+    const ContactInfo& contact = person.contact();
+    const Address& address = contact.address();
+
+    PersonSnapshot snap;
+    snap.age = person.age();
+    snap.height = person.height();
+    snap.name = rust::String(person.name());
+    snap.city = rust::String(address.city());
+    snap.email = rust::String(contact.email());
+    snap.phone = rust::String(contact.phone());
+    snap.postal_code = rust::String(address.postal_code());
+    return snap;
 }
 
@@ -1,31 +1,84 @@
 #pragma once
 
-#include <string>
+#include <array>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 // C++ defined structs - these are "existing" C++ classes
 // that we want to integrate with Rust
 
+// ----------------------------------------------------------------------------
+// Opt-in bridge instrumentation (compile with -DFFI_BRIDGE_STATS, or
+// configure CMake with -DFFI_BRIDGE_STATS=ON)
+//
+// When enabled, every getter shim counts its crossing and the bytes of
+// string data handed to Rust, per thread. Disabled builds compile the
+// macros to nothing so the zero-overhead default is preserved.
+// ----------------------------------------------------------------------------
+#ifdef FFI_BRIDGE_STATS
+struct BridgeStatsCounters {
+    unsigned long long getter_crossings = 0;
+    unsigned long long string_bytes = 0;
+};
+
+// Per-thread counters (defined in person.cpp)
+BridgeStatsCounters& bridge_stats_counters();
+
+#define FFI_STATS_CROSSING() (++bridge_stats_counters().getter_crossings)
+#define FFI_STATS_STRING(s) (bridge_stats_counters().string_bytes += (s).size())
+#else
+#define FFI_STATS_CROSSING() ((void)0)
+#define FFI_STATS_STRING(s) ((void)0)
+#endif
+
+// Dirty-field bits reported by the setters below and consumed by the
+// refresh_analysis bridge call (mirror DIRTY_* in rust-lib/src/lib.rs).
+// kDirtyWeight is for the caller-owned weight that lives outside the
+// Person graph.
+constexpr uint32_t kDirtyAge = 1u << 0;
+constexpr uint32_t kDirtyHeight = 1u << 1;
+constexpr uint32_t kDirtyName = 1u << 2;
+constexpr uint32_t kDirtyEmail = 1u << 3;
+constexpr uint32_t kDirtyPhone = 1u << 4;
+constexpr uint32_t kDirtyStreet = 1u << 5;
+constexpr uint32_t kDirtyCity = 1u << 6;
+constexpr uint32_t kDirtyPostal = 1u << 7;
+constexpr uint32_t kDirtyWeight = 1u << 8;
+
 /// Address information - a typical C++ class
 class Address {
 private:
     std::string street_;
     std::string city_;
     std::string postal_code_;
+    uint32_t dirty_ = 0;
 
 public:
     Address(const std::string& street, const std::string& city, const std::string& postal_code)
         : street_(street), city_(city), postal_code_(postal_code) {}
+
+    // Move overload: adopts the caller's string buffers instead of
+    // copying them (callers done with their strings should use this)
+    Address(std::string&& street, std::string&& city, std::string&& postal_code)
+        : street_(std::move(street)), city_(std::move(city)),
+          postal_code_(std::move(postal_code)) {}
     
     // Getters (needed for Rust FFI)
     const std::string& street() const { return street_; }
     const std::string& city() const { return city_; }
     const std::string& postal_code() const { return postal_code_; }
     
-    // Setters
-    void set_street(const std::string& street) { street_ = street; }
-    void set_city(const std::string& city) { city_ = city; }
-    void set_postal_code(const std::string& postal_code) { postal_code_ = postal_code; }
+    // Setters (each records its field in the dirty mask)
+    void set_street(const std::string& street) { street_ = street; dirty_ |= kDirtyStreet; }
+    void set_city(const std::string& city) { city_ = city; dirty_ |= kDirtyCity; }
+    void set_postal_code(const std::string& postal_code) { postal_code_ = postal_code; dirty_ |= kDirtyPostal; }
+
+    // Fields touched since the last clear_dirty()
+    uint32_t dirty_mask() const { return dirty_; }
+    void clear_dirty() { dirty_ = 0; }
 };
 
 /// Contact information with nested Address
@@ -34,10 +87,15 @@ private:
     std::string email_;
     std::string phone_;
     std::shared_ptr<Address> address_;
+    uint32_t dirty_ = 0;
 
 public:
     ContactInfo(const std::string& email, const std::string& phone, std::shared_ptr<Address> address)
         : email_(email), phone_(phone), address_(address) {}
+
+    // Move overload - see Address
+    ContactInfo(std::string&& email, std::string&& phone, std::shared_ptr<Address> address)
+        : email_(std::move(email)), phone_(std::move(phone)), address_(std::move(address)) {}
     
     // Getters
     const std::string& email() const { return email_; }
@@ -45,22 +103,46 @@ public:
     const Address& address() const { return *address_; }
     std::shared_ptr<Address> address_ptr() const { return address_; }
     
-    // Setters
-    void set_email(const std::string& email) { email_ = email; }
-    void set_phone(const std::string& phone) { phone_ = phone; }
+    // Setters (each records its field in the dirty mask)
+    void set_email(const std::string& email) { email_ = email; dirty_ |= kDirtyEmail; }
+    void set_phone(const std::string& phone) { phone_ = phone; dirty_ |= kDirtyPhone; }
+
+    // Own bits plus the nested Address's, so one read covers the subtree
+    uint32_t dirty_mask() const {
+        return dirty_ | (address_ ? address_->dirty_mask() : 0);
+    }
+    void clear_dirty() {
+        dirty_ = 0;
+        if (address_) {
+            address_->clear_dirty();
+        }
+    }
 };
 
 /// Person class - a typical C++ class with data and behavior
+///
+/// Concurrency contract: the const getters (and every get_* shim the
+/// Rust bridge calls) read plain members and touch no mutable state, so
+/// any number of threads may read one Person concurrently WITHOUT
+/// locking, provided no thread runs a setter during that time. Setters
+/// require exclusive access. To publish a Person to reader threads,
+/// hand it to freeze_person() below - the const-only handle makes the
+/// no-setters guarantee structural instead of conventional.
 class Person {
 private:
     uint32_t age_;
     double height_;
     std::string name_;
     std::shared_ptr<ContactInfo> contact_;
+    uint32_t dirty_ = 0;
 
 public:
     Person(uint32_t age, double height, const std::string& name, std::shared_ptr<ContactInfo> contact)
         : age_(age), height_(height), name_(name), contact_(contact) {}
+
+    // Move overload - see Address
+    Person(uint32_t age, double height, std::string&& name, std::shared_ptr<ContactInfo> contact)
+        : age_(age), height_(height), name_(std::move(name)), contact_(std::move(contact)) {}
     
     // Getters (these will be exposed to Rust)
     uint32_t age() const { return age_; }
@@ -68,10 +150,22 @@ public:
     const std::string& name() const { return name_; }
     const ContactInfo& contact() const { return *contact_; }
     
-    // Setters
-    void set_age(uint32_t age) { age_ = age; }
-    void set_height(double height) { height_ = height; }
-    void set_name(const std::string& name) { name_ = name; }
+    // Setters (each records its field in the dirty mask)
+    void set_age(uint32_t age) { age_ = age; dirty_ |= kDirtyAge; }
+    void set_height(double height) { height_ = height; dirty_ |= kDirtyHeight; }
+    void set_name(const std::string& name) { name_ = name; dirty_ |= kDirtyName; }
+
+    // Everything touched in the whole graph since the last clear_dirty();
+    // feed this to refresh_analysis to recompute only affected outputs
+    uint32_t dirty_mask() const {
+        return dirty_ | (contact_ ? contact_->dirty_mask() : 0);
+    }
+    void clear_dirty() {
+        dirty_ = 0;
+        if (contact_) {
+            contact_->clear_dirty();
+        }
+    }
     
     // C++ methods (business logic)
     bool is_adult() const { return age_ >= 18; }
@@ -81,6 +175,215 @@ public:
     }
 };
 
+/// Immutable published Person: const-only access, safe for lock-free
+/// concurrent reads from any number of analysis threads (see the
+/// concurrency contract on Person)
+using FrozenPerson = std::shared_ptr<const Person>;
+
+/// Freeze-on-publish: takes ownership of a fully built Person and
+/// returns the immutable handle. Once frozen there is no non-const
+/// path left, so readers need no defensive locking.
+inline FrozenPerson freeze_person(std::unique_ptr<Person> person) {
+    return FrozenPerson(std::move(person));
+}
+
+/// Concurrent registry of frozen persons keyed by record id
+///
+/// The map is split into independent shards, each with its own mutex,
+/// so a lookup locks only 1/kShards of the registry and worker threads
+/// stop serializing on a single global lock. Handles returned by find()
+/// are frozen, so the caller reads without further synchronization.
+class PersonRegistry {
+private:
+    static constexpr size_t kShards = 16;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        std::unordered_map<uint64_t, FrozenPerson> persons;
+    };
+
+    std::array<Shard, kShards> shards_;
+
+    static size_t shard_for(uint64_t id) {
+        // Fibonacci hash; the top bits select the shard so sequential
+        // ids spread instead of clustering in one shard
+        return (id * 0x9E3779B97F4A7C15ull) >> 60;
+    }
+
+public:
+    /// Publish (or replace) the frozen person under a record id
+    void publish(uint64_t id, FrozenPerson person);
+
+    /// Look up a published person; empty handle if absent
+    FrozenPerson find(uint64_t id) const;
+
+    /// Remove a record; returns false if it was not published
+    bool erase(uint64_t id);
+
+    /// Total published records (sums the shards; approximate under
+    /// concurrent mutation)
+    size_t size() const;
+
+    /// Shared process-wide instance
+    static PersonRegistry& instance() {
+        static PersonRegistry registry;
+        return registry;
+    }
+};
+
+/// Bump allocator for whole Person/ContactInfo/Address object graphs
+///
+/// Constructing one person normally costs four separate heap allocations
+/// plus two shared_ptr control blocks. The arena places all objects of a
+/// processing epoch contiguously in large chunks and hands out non-owning
+/// pointers; reset() bulk-frees the whole epoch at once instead of a
+/// per-object free() storm. Objects with non-trivial destructors (the
+/// std::string members) are finalized before their memory is reused.
+class PersonArena {
+private:
+    struct Finalizer {
+        void* object;
+        void (*destroy)(void*);
+    };
+
+    std::vector<std::unique_ptr<char[]>> chunks_;
+    std::vector<Finalizer> finalizers_;
+    size_t chunk_size_;
+    size_t chunk_index_;   // chunk currently being filled
+    size_t offset_;        // bump offset within the current chunk
+    size_t object_count_;
+
+    void* allocate(size_t size, size_t align);
+
+    template <typename T, typename... Args>
+    T* create(Args&&... args) {
+        void* memory = allocate(sizeof(T), alignof(T));
+        T* object = new (memory) T(std::forward<Args>(args)...);
+        finalizers_.push_back({object, [](void* p) { static_cast<T*>(p)->~T(); }});
+        ++object_count_;
+        return object;
+    }
+
+public:
+    explicit PersonArena(size_t chunk_size = 64 * 1024);
+    ~PersonArena();
+
+    PersonArena(const PersonArena&) = delete;
+    PersonArena& operator=(const PersonArena&) = delete;
+
+    /// Arena-backed construction - pointers stay valid until reset()
+    Address* create_address(const std::string& street,
+                            const std::string& city,
+                            const std::string& postal_code);
+    ContactInfo* create_contact_info(const std::string& email,
+                                     const std::string& phone,
+                                     Address* address);
+    Person* create_person(uint32_t age,
+                          double height,
+                          const std::string& name,
+                          ContactInfo* contact);
+
+    /// Bulk-free the epoch: destroy all objects, keep chunks for reuse
+    void reset();
+
+    size_t object_count() const { return object_count_; }
+    size_t chunk_count() const { return chunks_.size(); }
+};
+
+/// Process-wide city interning dictionary
+///
+/// Maps city strings to dense u32 ids so bridge structs can carry a
+/// 4-byte id instead of allocating a fresh String per record. With
+/// millions of records from a handful of cities, interning turns the
+/// per-record string allocation into a hash lookup and the city-risk
+/// string match on the Rust side into an array index.
+class CityDictionary {
+private:
+    std::vector<std::string> names_;               // dense id -> name
+    std::unordered_map<std::string, uint32_t> ids_; // name -> dense id
+
+public:
+    /// Return the id for a city, inserting it on first sight
+    uint32_t intern(const std::string& city) {
+        auto it = ids_.find(city);
+        if (it != ids_.end()) {
+            return it->second;
+        }
+        uint32_t id = static_cast<uint32_t>(names_.size());
+        names_.push_back(city);
+        ids_.emplace(city, id);
+        return id;
+    }
+
+    const std::string& name(uint32_t id) const { return names_[id]; }
+    size_t size() const { return names_.size(); }
+
+    /// Shared process-wide instance
+    static CityDictionary& instance() {
+        static CityDictionary dict;
+        return dict;
+    }
+};
+
+/// Structure-of-arrays batch of person data for vectorized analysis
+///
+/// Instead of one cache line per object graph (Person -> shared_ptr
+/// ContactInfo -> shared_ptr Address), fields live in contiguous columns
+/// so the hot BMI/risk arithmetic runs over flat arrays the compiler can
+/// auto-vectorize. City names are interned to dense u32 ids.
+class PersonColumnBatch {
+private:
+    std::vector<uint32_t> ages_;
+    std::vector<double> heights_;
+    std::vector<double> weights_;
+    std::vector<uint32_t> city_ids_;
+    std::vector<std::string> cities_;  // dense city id -> name
+
+public:
+    /// Append one person's fields (plus weight) to the columns
+    void push_person(const Person& person, double weight_kg);
+
+    size_t size() const { return ages_.size(); }
+    size_t city_count() const { return cities_.size(); }
+
+    const std::vector<uint32_t>& ages() const { return ages_; }
+    const std::vector<double>& heights() const { return heights_; }
+    const std::vector<double>& weights() const { return weights_; }
+    const std::vector<uint32_t>& city_ids() const { return city_ids_; }
+    const std::string& city_name(uint32_t id) const { return cities_[id]; }
+};
+
+/// Packed contact fields for one-crossing batch validation
+///
+/// Every email/phone/city/postal byte of the batch lives in one
+/// contiguous buffer; offsets() holds 4 entries per record plus a
+/// trailing end, so the Rust validator (validate_contact_packed) scans
+/// field spans straight out of the buffer - no per-record FFI getters,
+/// no copies beyond the initial pack.
+class ContactBatch {
+private:
+    std::string bytes_;
+    std::vector<uint32_t> offsets_{0};
+
+    void append_field(const std::string& field) {
+        bytes_.append(field);
+        offsets_.push_back(static_cast<uint32_t>(bytes_.size()));
+    }
+
+public:
+    /// Append one contact's four validated fields to the pack
+    void push_contact(const ContactInfo& contact) {
+        append_field(contact.email());
+        append_field(contact.phone());
+        append_field(contact.address().city());
+        append_field(contact.address().postal_code());
+    }
+
+    size_t size() const { return (offsets_.size() - 1) / 4; }
+    const std::string& bytes() const { return bytes_; }
+    const std::vector<uint32_t>& offsets() const { return offsets_; }
+};
+
 // Factory functions for convenient construction (exposed to Rust)
 std::unique_ptr<Address> create_address(const std::string& street, 
                                        const std::string& city, 
@@ -95,17 +398,159 @@ std::unique_ptr<Person> create_person(uint32_t age,
                                      const std::string& name,
                                      std::shared_ptr<ContactInfo> contact);
 
-// Getter functions for Rust FFI (these bridge the gap)
-uint32_t get_person_age(const Person& person);
-double get_person_height(const Person& person);
-const std::string& get_person_name(const Person& person);
-const ContactInfo& get_person_contact(const Person& person);
+// Move overloads: the caller's string buffers are adopted, not copied.
+// Overload resolution picks these automatically for rvalue arguments,
+// so `create_address(std::move(street), ...)` does zero string copies.
+std::unique_ptr<Address> create_address(std::string&& street,
+                                        std::string&& city,
+                                        std::string&& postal_code);
+
+std::unique_ptr<ContactInfo> create_contact_info(std::string&& email,
+                                                 std::string&& phone,
+                                                 std::shared_ptr<Address> address);
+
+std::unique_ptr<Person> create_person(uint32_t age,
+                                      double height,
+                                      std::string&& name,
+                                      std::shared_ptr<ContactInfo> contact);
+
+// Emplace-style bulk constructor: builds the whole Address ->
+// ContactInfo -> Person graph from moved parts in one call. The six
+// strings travel by move end to end, so ingesting a record performs no
+// string copies at all (by-value sink parameters: pass std::move(...)
+// or temporaries).
+std::unique_ptr<Person> emplace_person(uint32_t age,
+                                       double height,
+                                       std::string name,
+                                       std::string email,
+                                       std::string phone,
+                                       std::string street,
+                                       std::string city,
+                                       std::string postal_code);
+
+// Compact layout: the whole Address -> ContactInfo -> Person graph
+// lives in ONE heap block, so a record costs one allocation and the
+// getter chain never leaves it - versus three separate allocations
+// plus two shared_ptr control blocks for the classic graph. The inner
+// links are non-owning aliasing shared_ptrs (same trick as
+// PersonArena), so every existing getter and the cxx bridge work
+// unchanged. Strings within the SSO buffer stay inline; longer ones
+// still allocate as usual. The returned handle owns the whole block.
+std::shared_ptr<Person> make_compact_person(uint32_t age,
+                                            double height,
+                                            std::string name,
+                                            std::string email,
+                                            std::string phone,
+                                            std::string street,
+                                            std::string city,
+                                            std::string postal_code);
+
+// Arena-backed factory overloads - the arena owns the objects and the
+// returned pointers stay valid until the arena is reset or destroyed
+Address* create_address(PersonArena& arena,
+                        const std::string& street,
+                        const std::string& city,
+                        const std::string& postal_code);
+
+ContactInfo* create_contact_info(PersonArena& arena,
+                                 const std::string& email,
+                                 const std::string& phone,
+                                 Address* address);
+
+Person* create_person(PersonArena& arena,
+                      uint32_t age,
+                      double height,
+                      const std::string& name,
+                      ContactInfo* contact);
+
+// Getter shims for Rust FFI (these bridge the gap)
+//
+// Header-only and inline: Rust calls one of these for every field of
+// every record, so an out-of-line definition would put an extra call
+// frame on the hottest path in the system. Defined inline here, LTO can
+// collapse the Rust -> C++ getter call into a direct member load.
+
+inline uint32_t get_person_age(const Person& person) {
+    FFI_STATS_CROSSING();
+    return person.age();
+}
+
+inline double get_person_height(const Person& person) {
+    FFI_STATS_CROSSING();
+    return person.height();
+}
+
+inline const std::string& get_person_name(const Person& person) {
+    FFI_STATS_CROSSING();
+    FFI_STATS_STRING(person.name());
+    return person.name();
+}
+
+inline const ContactInfo& get_person_contact(const Person& person) {
+    FFI_STATS_CROSSING();
+    return person.contact();
+}
+
+inline const std::string& get_contact_email(const ContactInfo& contact) {
+    FFI_STATS_CROSSING();
+    FFI_STATS_STRING(contact.email());
+    return contact.email();
+}
+
+inline const std::string& get_contact_phone(const ContactInfo& contact) {
+    FFI_STATS_CROSSING();
+    FFI_STATS_STRING(contact.phone());
+    return contact.phone();
+}
+
+inline const Address& get_contact_address(const ContactInfo& contact) {
+    FFI_STATS_CROSSING();
+    return contact.address();
+}
+
+inline const std::string& get_address_street(const Address& address) {
+    FFI_STATS_CROSSING();
+    FFI_STATS_STRING(address.street());
+    return address.street();
+}
+
+inline const std::string& get_address_city(const Address& address) {
+    FFI_STATS_CROSSING();
+    FFI_STATS_STRING(address.city());
+    return address.city();
+}
+
+inline const std::string& get_address_postal_code(const Address& address) {
+    FFI_STATS_CROSSING();
+    FFI_STATS_STRING(address.postal_code());
+    return address.postal_code();
+}
+
+// Getter-side stats for the bridge (always declared; zero when the
+// instrumentation is compiled out)
+uint64_t bridge_getter_crossings();
+uint64_t bridge_string_bytes();
+void reset_bridge_getter_stats();
+
+// Bridge struct defined by cxx in the generated header (lib.rs.h);
+// forward-declared here so the snapshot function can be declared for Rust
+struct PersonSnapshot;
+
+// Copy all Person fields into one flat bridge struct (single FFI crossing)
+PersonSnapshot snapshot_person(const Person& person);
 
-const std::string& get_contact_email(const ContactInfo& contact);
-const std::string& get_contact_phone(const ContactInfo& contact);
-const Address& get_contact_address(const ContactInfo& contact);
+// City dictionary bridge functions (shared process-wide instance)
+uint32_t intern_city(const std::string& city);
+const std::string& city_dictionary_name(uint32_t id);
+size_t city_dictionary_size();
 
-const std::string& get_address_street(const Address& address);
-const std::string& get_address_city(const Address& address);
-const std::string& get_address_postal_code(const Address& address);
+// Column accessors for PersonColumnBatch (raw pointer + length so the
+// header stays free of bridge types; Rust rebuilds slices from these)
+size_t batch_size(const PersonColumnBatch& batch);
+const uint32_t* batch_ages_ptr(const PersonColumnBatch& batch);
+const double* batch_heights_ptr(const PersonColumnBatch& batch);
+const double* batch_weights_ptr(const PersonColumnBatch& batch);
+const uint32_t* batch_city_ids_ptr(const PersonColumnBatch& batch);
+size_t batch_city_count(const PersonColumnBatch& batch);
+const std::string& batch_city_name(const PersonColumnBatch& batch, uint32_t id);
 
@@ -0,0 +1,142 @@
+#include "person_file.h"
+
+#include <cstring>
+#include <fstream>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// PersonFileWriter implementation
+
+uint32_t PersonFileWriter::add_string(const std::string& value) {
+    uint32_t offset = static_cast<uint32_t>(strings_.size());
+    strings_.append(value);
+    return offset;
+}
+
+void PersonFileWriter::add_person(const Person& person, double weight_kg) {
+    const ContactInfo& contact = person.contact();
+    const Address& address = contact.address();
+
+    PersonFileRecord record{};
+    record.age = person.age();
+    record.height = person.height();
+    record.weight = weight_kg;
+
+    record.name_off = add_string(person.name());
+    record.name_len = static_cast<uint32_t>(person.name().size());
+    record.city_off = add_string(address.city());
+    record.city_len = static_cast<uint32_t>(address.city().size());
+    record.email_off = add_string(contact.email());
+    record.email_len = static_cast<uint32_t>(contact.email().size());
+    record.phone_off = add_string(contact.phone());
+    record.phone_len = static_cast<uint32_t>(contact.phone().size());
+    record.postal_off = add_string(address.postal_code());
+    record.postal_len = static_cast<uint32_t>(address.postal_code().size());
+
+    records_.push_back(record);
+}
+
+bool PersonFileWriter::write(const std::string& path) const {
+    PersonFileHeader header{};
+    header.magic = kPersonFileMagic;
+    header.version = kPersonFileVersion;
+    header.record_count = records_.size();
+    header.string_table_offset =
+        sizeof(PersonFileHeader) + records_.size() * sizeof(PersonFileRecord);
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(records_.data()),
+              static_cast<std::streamsize>(records_.size() * sizeof(PersonFileRecord)));
+    out.write(strings_.data(), static_cast<std::streamsize>(strings_.size()));
+    return static_cast<bool>(out);
+}
+
+// PersonFile implementation
+
+bool PersonFile::open(const std::string& path) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st{};
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(PersonFileHeader)) {
+        ::close(fd);
+        return false;
+    }
+
+    size_t size = static_cast<size_t>(st.st_size);
+    void* base = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);  // the mapping keeps its own reference
+    if (base == MAP_FAILED) {
+        return false;
+    }
+
+    // Validate the header before trusting any offsets
+    PersonFileHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    bool valid = header.magic == kPersonFileMagic &&
+                 header.version == kPersonFileVersion &&
+                 header.string_table_offset <= size &&
+                 sizeof(PersonFileHeader) + header.record_count * sizeof(PersonFileRecord) <=
+                     header.string_table_offset;
+    if (!valid) {
+        munmap(base, size);
+        return false;
+    }
+
+    base_ = base;
+    size_ = size;
+    return true;
+}
+
+void PersonFile::close() {
+    if (base_) {
+        munmap(base_, size_);
+        base_ = nullptr;
+        size_ = 0;
+    }
+}
+
+size_t PersonFile::record_count() const {
+    if (!base_) {
+        return 0;
+    }
+    return static_cast<size_t>(
+        reinterpret_cast<const PersonFileHeader*>(base_)->record_count);
+}
+
+const PersonFileRecord& PersonFile::record(size_t index) const {
+    const uint8_t* records = data() + sizeof(PersonFileHeader);
+    return reinterpret_cast<const PersonFileRecord*>(records)[index];
+}
+
+std::string_view PersonFile::field(uint32_t offset, uint32_t length) const {
+    const auto* header = reinterpret_cast<const PersonFileHeader*>(base_);
+    const char* strings =
+        reinterpret_cast<const char*>(data() + header->string_table_offset);
+    return std::string_view(strings + offset, length);
+}
+
+// Bridge accessor implementations
+
+size_t person_file_record_count(const PersonFile& file) {
+    return file.record_count();
+}
+
+const uint8_t* person_file_data_ptr(const PersonFile& file) {
+    return file.data();
+}
+
+size_t person_file_size_bytes(const PersonFile& file) {
+    return file.size_bytes();
+}
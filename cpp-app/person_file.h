@@ -0,0 +1,104 @@
+#pragma once
+
+#include "person.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Flat, memory-mappable person record file format
+//
+// Datasets that no longer fit in RAM as live Person/ContactInfo/Address
+// graphs can be written once into this format and then processed by
+// mmap + sequential scan, with no std::string or shared_ptr constructed
+// per record. Layout:
+//
+//   PersonFileHeader
+//   PersonFileRecord[record_count]   (fixed 64-byte records)
+//   string table                     (raw bytes, offset+length addressed)
+//
+// All integers are little-endian. The Rust side (analyze_health_file in
+// lib.rs) parses the same layout directly from the mapped bytes - keep
+// the two in sync and bump the version on any change.
+
+constexpr uint32_t kPersonFileMagic = 0x4E535250;  // "PRSN"
+constexpr uint32_t kPersonFileVersion = 1;
+
+struct PersonFileHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint64_t record_count;
+    uint64_t string_table_offset;  // from start of file
+};
+
+struct PersonFileRecord {
+    uint32_t age;
+    uint32_t reserved;  // keeps height 8-byte aligned
+    double height;
+    double weight;
+    // String fields as offset+length into the string table
+    uint32_t name_off, name_len;
+    uint32_t city_off, city_len;
+    uint32_t email_off, email_len;
+    uint32_t phone_off, phone_len;
+    uint32_t postal_off, postal_len;
+};
+
+static_assert(sizeof(PersonFileHeader) == 24, "header layout is part of the file format");
+static_assert(sizeof(PersonFileRecord) == 64, "record layout is part of the file format");
+
+/// Builds a person record file from live objects, then writes it out
+class PersonFileWriter {
+private:
+    std::vector<PersonFileRecord> records_;
+    std::string strings_;
+
+    uint32_t add_string(const std::string& value);
+
+public:
+    /// Append one person (plus its analysis weight) as a flat record
+    void add_person(const Person& person, double weight_kg);
+
+    size_t record_count() const { return records_.size(); }
+
+    /// Write header, records, and string table; returns false on I/O error
+    bool write(const std::string& path) const;
+};
+
+/// Read-only memory-mapped view of a person record file
+///
+/// open() maps the whole file; record and string accesses are direct
+/// reads from the mapping, so files larger than memory stream through
+/// the page cache at near disk bandwidth.
+class PersonFile {
+private:
+    void* base_;
+    size_t size_;
+
+public:
+    PersonFile() : base_(nullptr), size_(0) {}
+    ~PersonFile() { close(); }
+
+    PersonFile(const PersonFile&) = delete;
+    PersonFile& operator=(const PersonFile&) = delete;
+
+    /// Map the file read-only; validates magic, version, and bounds
+    bool open(const std::string& path);
+    void close();
+
+    bool is_open() const { return base_ != nullptr; }
+    size_t record_count() const;
+
+    const uint8_t* data() const { return static_cast<const uint8_t*>(base_); }
+    size_t size_bytes() const { return size_; }
+
+    const PersonFileRecord& record(size_t index) const;
+    std::string_view field(uint32_t offset, uint32_t length) const;
+};
+
+// Bridge accessors: Rust takes the raw mapping and parses the shared
+// layout itself, so scanning a record makes zero C++ calls
+size_t person_file_record_count(const PersonFile& file);
+const uint8_t* person_file_data_ptr(const PersonFile& file);
+size_t person_file_size_bytes(const PersonFile& file);
@@ -0,0 +1,169 @@
+#include "person_loader.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+namespace {
+
+// Fields per record: age,height,weight,name,email,phone,street,city,postal
+constexpr size_t kFieldCount = 9;
+
+// Split one line into exactly kFieldCount comma-separated fields.
+// Returns false (and leaves `fields` unspecified) on a malformed line.
+bool split_fields(std::string_view line, std::string_view (&fields)[kFieldCount]) {
+    size_t start = 0;
+    for (size_t i = 0; i < kFieldCount; ++i) {
+        if (i + 1 == kFieldCount) {
+            fields[i] = line.substr(start);
+            return true;
+        }
+        size_t comma = line.find(',', start);
+        if (comma == std::string_view::npos) {
+            return false;  // too few fields
+        }
+        fields[i] = line.substr(start, comma - start);
+        start = comma + 1;
+    }
+    return false;
+}
+
+bool parse_u32(std::string_view field, uint32_t& out) {
+    char* end = nullptr;
+    // Fields are views into the slab; strtoul stops at the first
+    // non-digit, so the trailing comma/newline terminates the parse
+    unsigned long value = std::strtoul(field.data(), &end, 10);
+    if (end == field.data()) {
+        return false;
+    }
+    out = static_cast<uint32_t>(value);
+    return true;
+}
+
+bool parse_f64(std::string_view field, double& out) {
+    char* end = nullptr;
+    double value = std::strtod(field.data(), &end);
+    if (end == field.data()) {
+        return false;
+    }
+    out = value;
+    return true;
+}
+
+}  // namespace
+
+PersonLoader::LoadResult PersonLoader::parse_slab(std::string_view slab) {
+    LoadResult result;
+    size_t pos = 0;
+    while (pos < slab.size()) {
+        size_t eol = slab.find('\n', pos);
+        if (eol == std::string_view::npos) {
+            eol = slab.size();
+        }
+        std::string_view line = slab.substr(pos, eol - pos);
+        pos = eol + 1;
+        if (!line.empty() && line.back() == '\r') {
+            line.remove_suffix(1);
+        }
+        if (line.empty() || line.front() == '#') {
+            continue;
+        }
+
+        std::string_view fields[kFieldCount];
+        uint32_t age = 0;
+        double height = 0.0;
+        double weight = 0.0;
+        if (!split_fields(line, fields) || !parse_u32(fields[0], age) ||
+            !parse_f64(fields[1], height) || !parse_f64(fields[2], weight)) {
+            ++result.bad_lines;
+            continue;
+        }
+
+        // The string(field) copies below are the only copies a record
+        // ever pays: emplace_person moves them through the whole graph
+        result.persons.push_back(emplace_person(
+            age, height, std::string(fields[3]), std::string(fields[4]),
+            std::string(fields[5]), std::string(fields[6]),
+            std::string(fields[7]), std::string(fields[8])));
+        result.weights.push_back(weight);
+    }
+    return result;
+}
+
+PersonLoader::LoadResult PersonLoader::load_csv_buffer(std::string_view text,
+                                                       unsigned threads) {
+    if (threads == 0) {
+        threads = std::thread::hardware_concurrency();
+        if (threads == 0) {
+            threads = 1;
+        }
+    }
+    if (threads == 1 || text.size() < 64 * 1024) {
+        // Small inputs: slab bookkeeping costs more than it saves
+        return parse_slab(text);
+    }
+
+    // Cut the buffer into one slab per thread, rounding each boundary
+    // forward to the next newline so no line straddles two slabs
+    std::vector<std::string_view> slabs;
+    size_t target = text.size() / threads;
+    size_t start = 0;
+    for (unsigned i = 0; i + 1 < threads && start < text.size(); ++i) {
+        size_t end = start + target;
+        if (end >= text.size()) {
+            break;
+        }
+        size_t newline = text.find('\n', end);
+        if (newline == std::string_view::npos) {
+            break;
+        }
+        slabs.push_back(text.substr(start, newline + 1 - start));
+        start = newline + 1;
+    }
+    if (start < text.size()) {
+        slabs.push_back(text.substr(start));
+    }
+
+    // One parser thread per slab, each filling its own result - no
+    // shared state until the in-order merge below
+    std::vector<LoadResult> partials(slabs.size());
+    std::vector<std::thread> workers;
+    workers.reserve(slabs.size());
+    for (size_t i = 0; i < slabs.size(); ++i) {
+        workers.emplace_back(
+            [&partials, &slabs, i] { partials[i] = parse_slab(slabs[i]); });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    LoadResult merged;
+    size_t total = 0;
+    for (const auto& partial : partials) {
+        total += partial.persons.size();
+    }
+    merged.persons.reserve(total);
+    merged.weights.reserve(total);
+    for (auto& partial : partials) {
+        for (auto& person : partial.persons) {
+            merged.persons.push_back(std::move(person));
+        }
+        merged.weights.insert(merged.weights.end(), partial.weights.begin(),
+                              partial.weights.end());
+        merged.bad_lines += partial.bad_lines;
+    }
+    return merged;
+}
+
+PersonLoader::LoadResult PersonLoader::load_csv_file(const std::string& path,
+                                                     unsigned threads) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return LoadResult{};
+    }
+    std::ostringstream buffer;
+    buffer << file.rdbuf();
+    std::string text = buffer.str();
+    return load_csv_buffer(text, threads);
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "person.h"
+
+/// Bulk CSV ingest for Person graphs
+///
+/// Input is one record per line:
+///
+///   age,height,weight,name,email,phone,street,city,postal_code
+///
+/// The buffer is split into one slab per thread at newline boundaries
+/// and each slab is parsed independently, so a file that takes minutes
+/// to ingest line-by-line parses in parallel with no cross-thread
+/// coordination until the final in-order merge. Construction goes
+/// through emplace_person, so the parsed strings are moved - never
+/// copied - into the graphs.
+class PersonLoader {
+public:
+    /// A loaded batch: persons and their weights share an index, ready
+    /// to hand to the Rust batch/parallel analysis entry points
+    struct LoadResult {
+        std::vector<std::unique_ptr<Person>> persons;
+        std::vector<double> weights;
+        size_t bad_lines = 0;  // malformed lines skipped during parse
+    };
+
+    /// Parse an in-memory CSV buffer with `threads` parser threads
+    /// (0 = one per hardware thread). Record order is preserved.
+    static LoadResult load_csv_buffer(std::string_view text, unsigned threads = 0);
+
+    /// Read a whole CSV file and parse it as load_csv_buffer does.
+    /// Returns an empty result if the file cannot be read.
+    static LoadResult load_csv_file(const std::string& path, unsigned threads = 0);
+
+private:
+    // Parse one slab of complete lines into its own result
+    static LoadResult parse_slab(std::string_view slab);
+};
@@ -0,0 +1,164 @@
+// Multithreaded pipeline driver for the C++ <-> Rust FFI demo
+//
+// The main demo (main.cpp) runs create -> process_person -> analyze_health
+// serially on one thread. This driver splits the same work into pipeline
+// stages connected by bounded lock-free SPSC queues:
+//
+//   construction thread --> N analysis workers --> formatting thread
+//
+// Construction round-robins persons across one SPSC queue per worker and
+// each worker pushes results into its own SPSC queue toward the single
+// formatting thread, so every queue keeps exactly one producer and one
+// consumer. The Rust analysis functions only read through const getters,
+// so concurrent workers need no synchronization on the Person objects.
+
+#include "person.h"
+#include "spsc_queue.h"
+
+// Include the cxx-generated header (for Rust FFI)
+#include "rust-lib/src/lib.rs.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr size_t kQueueCapacity = 1024;
+
+// Work item flowing from construction to an analysis worker
+struct WorkItem {
+    const Person* person = nullptr;
+    double weight_kg = 0.0;
+};
+
+// Result flowing from a worker to the formatting stage
+struct ResultItem {
+    double bmi = 0.0;
+    double risk_score = 0.0;
+    bool is_adult = false;
+};
+
+using WorkQueue = SpscQueue<WorkItem, kQueueCapacity>;
+using ResultQueue = SpscQueue<ResultItem, kQueueCapacity>;
+
+// Synthetic input data - a few city/weight combinations cycled over
+const char* kCities[] = {"New York", "Los Angeles", "Boston", "Chicago"};
+
+std::unique_ptr<Person> make_synthetic_person(size_t index) {
+    auto address = std::make_shared<Address>(
+        "1 Pipeline Rd", kCities[index % 4], "10001");
+    auto contact = std::make_shared<ContactInfo>(
+        "worker@example.com", "555-0000", address);
+    uint32_t age = static_cast<uint32_t>(16 + index % 60);
+    double height = 1.50 + 0.01 * (index % 50);
+    return std::make_unique<Person>(age, height, "Synthetic Person", contact);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    size_t total_persons = 100000;
+    size_t num_workers = std::max(1u, std::thread::hardware_concurrency() / 2);
+    if (argc > 1) total_persons = std::stoul(argv[1]);
+    if (argc > 2) num_workers = std::stoul(argv[2]);
+
+    std::cout << "Pipeline mode: " << total_persons << " persons, "
+              << num_workers << " analysis workers" << std::endl;
+
+    // Construction keeps ownership here; workers only read
+    std::vector<std::unique_ptr<Person>> persons(total_persons);
+
+    std::vector<std::unique_ptr<WorkQueue>> work_queues;
+    std::vector<std::unique_ptr<ResultQueue>> result_queues;
+    for (size_t i = 0; i < num_workers; ++i) {
+        work_queues.push_back(std::make_unique<WorkQueue>());
+        result_queues.push_back(std::make_unique<ResultQueue>());
+    }
+
+    std::atomic<bool> construction_done{false};
+    std::vector<std::atomic<bool>> worker_done(num_workers);
+    for (auto& flag : worker_done) flag.store(false);
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Stage 1: construction
+    std::thread construction([&] {
+        for (size_t i = 0; i < total_persons; ++i) {
+            persons[i] = make_synthetic_person(i);
+            WorkItem item{persons[i].get(), 55.0 + static_cast<double>(i % 40)};
+            WorkQueue& queue = *work_queues[i % num_workers];
+            while (!queue.try_push(std::move(item))) {
+                std::this_thread::yield();  // queue full - downstream is busy
+            }
+        }
+        construction_done.store(true, std::memory_order_release);
+    });
+
+    // Stage 2: N parallel analysis workers calling into Rust
+    std::vector<std::thread> workers;
+    for (size_t w = 0; w < num_workers; ++w) {
+        workers.emplace_back([&, w] {
+            WorkQueue& in = *work_queues[w];
+            ResultQueue& out = *result_queues[w];
+            WorkItem item;
+            for (;;) {
+                if (in.try_pop(item)) {
+                    HealthAnalysis analysis = analyze_health(*item.person, item.weight_kg);
+                    ResultItem result{analysis.bmi, analysis.risk_score,
+                                      item.person->is_adult()};
+                    while (!out.try_push(std::move(result))) {
+                        std::this_thread::yield();
+                    }
+                } else if (construction_done.load(std::memory_order_acquire) && in.empty()) {
+                    break;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            worker_done[w].store(true, std::memory_order_release);
+        });
+    }
+
+    // Stage 3: formatting/aggregation on this thread
+    size_t results_seen = 0;
+    size_t adults = 0;
+    double risk_sum = 0.0;
+    double max_bmi = 0.0;
+    while (results_seen < total_persons) {
+        bool made_progress = false;
+        for (size_t w = 0; w < num_workers; ++w) {
+            ResultItem result;
+            while (result_queues[w]->try_pop(result)) {
+                ++results_seen;
+                if (result.is_adult) ++adults;
+                risk_sum += result.risk_score;
+                if (result.bmi > max_bmi) max_bmi = result.bmi;
+                made_progress = true;
+            }
+        }
+        if (!made_progress) {
+            std::this_thread::yield();
+        }
+    }
+
+    construction.join();
+    for (auto& worker : workers) worker.join();
+
+    auto elapsed = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "Processed " << results_seen << " persons in "
+              << elapsed << "s ("
+              << static_cast<size_t>(results_seen / elapsed) << " persons/s)"
+              << std::endl;
+    std::cout << "Adults: " << adults
+              << ", mean risk: " << risk_sum / static_cast<double>(results_seen)
+              << ", max BMI: " << max_bmi << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,204 @@
+// Shared-memory analysis server for multi-process deployment
+//
+// Serves the request/response rings defined in shm_transport.h: worker
+// processes write ShmRequests into the segment and ring the request
+// doorbell; this process runs the Rust analysis and answers through the
+// response ring. Risk tables and caches load once HERE instead of once
+// per worker process.
+//
+// Usage: shm_server [segment_name] [options]
+//   --risk-table <path>  load a city-risk CSV before serving
+//   --demo               fork a demo worker that submits a few requests
+//                        and shuts the server down (for smoke testing)
+//
+// A request with ticket 0 asks the server to exit.
+
+#include "shm_transport.h"
+
+// Include the cxx-generated header (for Rust FFI)
+#include "rust-lib/src/lib.rs.h"
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+const char* kDefaultSegment = "/ffi_demo_shm";
+
+// Serve the rings until a shutdown request arrives
+void serve(ShmSegment* segment) {
+    segment->server_ready.store(1, std::memory_order_release);
+    bool running = true;
+    while (running) {
+        uint32_t seen = segment->request_bell.value();
+        bool handled = false;
+        ShmRequest request;
+        while (segment->requests.try_pop(request)) {
+            handled = true;
+            if (request.ticket == 0) {
+                running = false;
+                break;
+            }
+            // Rebuild the snapshot the analysis expects; only the
+            // fields analyze_health reads travel through the ring
+            PersonSnapshot snapshot;
+            snapshot.age = request.age;
+            snapshot.height = request.height;
+            snapshot.city = rust::String(request.city.view().data(),
+                                         request.city.view().size());
+            HealthAnalysis analysis =
+                analyze_snapshot(snapshot, request.weight_kg);
+
+            ShmResponse response;
+            response.ticket = request.ticket;
+            response.bmi = analysis.bmi;
+            response.risk_score = analysis.risk_score;
+            response.city_risk_factor = analysis.city_risk_factor;
+            response.recommendation_id =
+                recommendation_id(analysis.risk_score);
+            while (!segment->responses.try_push(std::move(response))) {
+                // Worker is behind - let it drain
+            }
+            segment->response_bell.ring();
+        }
+        if (!handled && running) {
+            segment->request_bell.wait(seen);
+        }
+    }
+}
+
+// Demo worker: what a real worker process does, in miniature
+int run_demo_worker(const std::string& segment_name) {
+    ShmSegment* segment = nullptr;
+    for (int attempt = 0; attempt < 1000 && segment == nullptr; ++attempt) {
+        segment = shm_attach_segment(segment_name);
+        if (segment == nullptr) {
+            usleep(1000);
+        }
+    }
+    if (segment == nullptr ||
+        segment->server_ready.load(std::memory_order_acquire) == 0) {
+        // Keep waiting for the server to finish construction
+        while (segment != nullptr &&
+               segment->server_ready.load(std::memory_order_acquire) == 0) {
+            usleep(1000);
+        }
+    }
+    if (segment == nullptr) {
+        std::cerr << "demo worker: could not attach " << segment_name
+                  << std::endl;
+        return 1;
+    }
+
+    struct DemoCase {
+        uint32_t age;
+        double height;
+        double weight;
+        const char* city;
+    };
+    const std::vector<DemoCase> cases = {
+        {30, 1.75, 70.0, "New York"},
+        {70, 1.60, 80.0, "Los Angeles"},
+        {16, 1.80, 60.0, "Boston"},
+    };
+
+    for (size_t i = 0; i < cases.size(); ++i) {
+        ShmRequest request;
+        request.ticket = i + 1;
+        request.age = cases[i].age;
+        request.height = cases[i].height;
+        request.weight_kg = cases[i].weight;
+        request.city.assign(cases[i].city);
+        while (!segment->requests.try_push(std::move(request))) {
+        }
+    }
+    segment->request_bell.ring();
+
+    size_t received = 0;
+    while (received < cases.size()) {
+        uint32_t seen = segment->response_bell.value();
+        ShmResponse response;
+        bool any = false;
+        while (segment->responses.try_pop(response)) {
+            any = true;
+            std::cout << "worker: ticket " << response.ticket << " bmi "
+                      << response.bmi << " risk " << response.risk_score
+                      << " (\""
+                      << std::string(recommendation_text(
+                             response.recommendation_id))
+                      << "\")" << std::endl;
+            ++received;
+        }
+        if (!any && received < cases.size()) {
+            segment->response_bell.wait(seen);
+        }
+    }
+
+    // Ask the server to exit
+    ShmRequest shutdown{};
+    shutdown.ticket = 0;
+    while (!segment->requests.try_push(std::move(shutdown))) {
+    }
+    segment->request_bell.ring();
+    shm_detach_segment(segment);
+    return 0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    std::string segment_name = kDefaultSegment;
+    std::string risk_table;
+    bool demo = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--demo") {
+            demo = true;
+        } else if (arg == "--risk-table" && i + 1 < argc) {
+            risk_table = argv[++i];
+        } else {
+            segment_name = arg;
+        }
+    }
+
+    if (!risk_table.empty()) {
+        size_t entries = load_city_risk_table(risk_table);
+        std::cout << "server: loaded " << entries
+                  << " risk entries (shared by every worker)" << std::endl;
+    }
+
+    ShmSegment* segment = shm_create_segment(segment_name);
+    if (segment == nullptr) {
+        std::cerr << "server: failed to create segment " << segment_name
+                  << std::endl;
+        return 1;
+    }
+    std::cout << "server: serving " << segment_name << " ("
+              << sizeof(ShmSegment) / 1024 << " KiB segment, ring capacity "
+              << kShmRingCapacity << ")" << std::endl;
+
+    pid_t worker = -1;
+    if (demo) {
+        worker = fork();
+        if (worker == 0) {
+            // Child re-attaches by name exactly like a real worker would
+            shm_detach_segment(segment);
+            return run_demo_worker(segment_name);
+        }
+    }
+
+    serve(segment);
+    std::cout << "server: shutdown request received" << std::endl;
+
+    if (worker > 0) {
+        int status = 0;
+        waitpid(worker, &status, 0);
+    }
+    shm_detach_segment(segment);
+    shm_unlink_segment(segment_name);
+    return 0;
+}
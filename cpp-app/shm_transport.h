@@ -0,0 +1,170 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <string>
+#include <string_view>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <climits>
+#else
+#include <chrono>
+#include <thread>
+#endif
+
+#include "spsc_queue.h"
+
+// Shared-memory request/response transport for multi-process deployment
+//
+// Several C++ worker processes talk to ONE analysis server (shm_server)
+// through fixed-size rings living in a POSIX shm segment, so the risk
+// tables and caches are loaded once in the server instead of once per
+// worker, and a request/response never copies through a socket - the
+// records are written in place in the ring.
+//
+// One segment serves one worker process: the rings are the SPSC queues
+// from spsc_queue.h (placement-constructed in the segment), so each
+// direction keeps exactly one producer and one consumer. Workers that
+// need their own channel open their own named segment.
+//
+// Records are PODs with inline strings (same idea as InlineStr24 on the
+// bridge), so a "zero-copy" exchange is a struct write plus a doorbell.
+
+/// Fixed inline string for shm records; truncates at capacity
+struct ShmString {
+    uint8_t len;
+    char bytes[31];
+
+    void assign(std::string_view text) {
+        len = static_cast<uint8_t>(text.size() < sizeof(bytes) ? text.size()
+                                                               : sizeof(bytes));
+        std::memcpy(bytes, text.data(), len);
+    }
+    std::string_view view() const { return std::string_view(bytes, len); }
+};
+
+/// Analysis request: the PersonSnapshot fields analyze_health consumes,
+/// plus the caller-owned weight. ticket 0 is reserved for shutdown.
+struct ShmRequest {
+    uint64_t ticket;
+    uint32_t age;
+    double height;
+    double weight_kg;
+    ShmString city;
+};
+
+/// Analysis response: the numeric HealthAnalysis results; the
+/// recommendation travels as its canonical id (see recommendation_text)
+struct ShmResponse {
+    uint64_t ticket;
+    double bmi;
+    double risk_score;
+    double city_risk_factor;
+    uint8_t recommendation_id;
+};
+
+/// Cross-process doorbell: a futex word on Linux, sleep-polling
+/// elsewhere. ring() wakes every waiter; wait() returns when the value
+/// moves past the snapshot the caller observed (or on a spurious wake -
+/// callers re-check their ring and wait again).
+class Doorbell {
+private:
+    std::atomic<uint32_t> counter_{0};
+
+public:
+    uint32_t value() const { return counter_.load(std::memory_order_acquire); }
+
+    void ring() {
+        counter_.fetch_add(1, std::memory_order_release);
+#if defined(__linux__)
+        // Not FUTEX_PRIVATE: waiters live in other processes
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&counter_), FUTEX_WAKE,
+                INT_MAX, nullptr, nullptr, 0);
+#endif
+    }
+
+    void wait(uint32_t seen) {
+#if defined(__linux__)
+        syscall(SYS_futex, reinterpret_cast<uint32_t*>(&counter_), FUTEX_WAIT,
+                seen, nullptr, nullptr, 0);
+#else
+        if (value() == seen) {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+#endif
+    }
+};
+
+inline constexpr uint32_t kShmMagic = 0x504D4853;  // "SHMP" little-endian
+inline constexpr uint32_t kShmVersion = 1;
+inline constexpr size_t kShmRingCapacity = 1024;
+
+/// The whole segment: header, doorbells, and the two rings.
+/// The server placement-constructs this; workers only attach.
+struct ShmSegment {
+    uint32_t magic = kShmMagic;
+    uint32_t version = kShmVersion;
+    std::atomic<uint32_t> server_ready{0};
+    Doorbell request_bell;   // rung by the worker after pushing requests
+    Doorbell response_bell;  // rung by the server after pushing responses
+    SpscQueue<ShmRequest, kShmRingCapacity> requests;
+    SpscQueue<ShmResponse, kShmRingCapacity> responses;
+};
+
+/// Server side: create (or recreate) the named segment and construct
+/// the rings in it. Returns nullptr on failure.
+inline ShmSegment* shm_create_segment(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+    if (fd < 0) {
+        return nullptr;
+    }
+    if (ftruncate(fd, static_cast<off_t>(sizeof(ShmSegment))) != 0) {
+        close(fd);
+        return nullptr;
+    }
+    void* memory = mmap(nullptr, sizeof(ShmSegment), PROT_READ | PROT_WRITE,
+                        MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        return nullptr;
+    }
+    return new (memory) ShmSegment();
+}
+
+/// Worker side: attach to an existing segment. Returns nullptr if the
+/// segment does not exist or its header does not match this build.
+inline ShmSegment* shm_attach_segment(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0);
+    if (fd < 0) {
+        return nullptr;
+    }
+    void* memory = mmap(nullptr, sizeof(ShmSegment), PROT_READ | PROT_WRITE,
+                        MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        return nullptr;
+    }
+    ShmSegment* segment = static_cast<ShmSegment*>(memory);
+    if (segment->magic != kShmMagic || segment->version != kShmVersion) {
+        munmap(memory, sizeof(ShmSegment));
+        return nullptr;
+    }
+    return segment;
+}
+
+inline void shm_detach_segment(ShmSegment* segment) {
+    if (segment != nullptr) {
+        munmap(segment, sizeof(ShmSegment));
+    }
+}
+
+inline void shm_unlink_segment(const std::string& name) {
+    shm_unlink(name.c_str());
+}
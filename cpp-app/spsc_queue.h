@@ -0,0 +1,55 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+/// Bounded lock-free single-producer/single-consumer queue
+///
+/// One thread may call try_push and one thread may call try_pop; the
+/// head/tail indices are the only shared state, so stage hand-off in the
+/// pipeline costs two atomic operations and no locks. Capacity must be a
+/// power of two so the ring index is a mask instead of a modulo.
+template <typename T, size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "Capacity must be a power of two");
+
+private:
+    static constexpr size_t kMask = Capacity - 1;
+
+    // Producer and consumer indices on separate cache lines to avoid
+    // false sharing between the two threads
+    alignas(64) std::atomic<size_t> head_{0};  // next slot to pop
+    alignas(64) std::atomic<size_t> tail_{0};  // next slot to push
+    std::array<T, Capacity> slots_;
+
+public:
+    /// Producer side - returns false when the queue is full
+    bool try_push(T&& value) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == Capacity) {
+            return false;
+        }
+        slots_[tail & kMask] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Consumer side - returns false when the queue is empty
+    bool try_pop(T& value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        value = std::move(slots_[head & kMask]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) ==
+               tail_.load(std::memory_order_acquire);
+    }
+};
@@ -4,13 +4,24 @@ fn main() {
         .parent()
         .expect("Failed to get project root");
     
-    cxx_build::bridge("src/lib.rs")
-        .flag_if_supported("-std=c++14")
+    let mut build = cxx_build::bridge("src/lib.rs");
+    build
+        .flag_if_supported("-std=c++17")
         .include(project_root)  // Add project root to include path for cpp-app/person.h
-        .file("../cpp-app/person.cpp")  // Include the C++ implementation file
-        .compile("rust_lib_cxx");
+        .file("../cpp-app/person.cpp")  // Include the C++ implementation files
+        .file("../cpp-app/person_file.cpp");
+
+    // Keep the C++ getter-shim instrumentation in sync with the Rust
+    // bridge-stats feature so one switch controls both sides
+    if std::env::var_os("CARGO_FEATURE_BRIDGE_STATS").is_some() {
+        build.define("FFI_BRIDGE_STATS", None);
+    }
+
+    build.compile("rust_lib_cxx");
 
     println!("cargo:rerun-if-changed=src/lib.rs");
     println!("cargo:rerun-if-changed=../cpp-app/person.h");
     println!("cargo:rerun-if-changed=../cpp-app/person.cpp");
+    println!("cargo:rerun-if-changed=../cpp-app/person_file.h");
+    println!("cargo:rerun-if-changed=../cpp-app/person_file.cpp");
 }
@@ -12,6 +12,7 @@ mod ffi {
         type Person;
         type ContactInfo;
         type Address;
+        type PersonColumnBatch;
         
         // Getter functions to access C++ object data from Rust
         // These are the bridge between opaque C++ types and Rust
@@ -27,6 +28,49 @@ mod ffi {
         fn get_address_street(address: &Address) -> &CxxString;
         fn get_address_city(address: &Address) -> &CxxString;
         fn get_address_postal_code(address: &Address) -> &CxxString;
+
+        // Getter-side instrumentation counters (zero when the
+        // bridge-stats feature / FFI_BRIDGE_STATS define is off)
+        fn bridge_getter_crossings() -> u64;
+        fn bridge_string_bytes() -> u64;
+        fn reset_bridge_getter_stats();
+
+        // Flatten a whole Person into one bridge struct in a single crossing,
+        // instead of Rust chasing getter chains field by field
+        fn snapshot_person(person: &Person) -> PersonSnapshot;
+
+        // City interning dictionary (shared process-wide C++ instance)
+        // Bridge structs carry the dense u32 id; display code resolves
+        // the name back through city_dictionary_name
+        fn intern_city(city: &CxxString) -> u32;
+        fn city_dictionary_name(id: u32) -> &'static CxxString;
+        fn city_dictionary_size() -> usize;
+
+        // Column accessors for the structure-of-arrays batch
+        // Raw pointer + length keeps person.h free of bridge types;
+        // Rust reassembles slices over the contiguous columns
+        fn batch_size(batch: &PersonColumnBatch) -> usize;
+        fn batch_ages_ptr(batch: &PersonColumnBatch) -> *const u32;
+        fn batch_heights_ptr(batch: &PersonColumnBatch) -> *const f64;
+        fn batch_weights_ptr(batch: &PersonColumnBatch) -> *const f64;
+        fn batch_city_ids_ptr(batch: &PersonColumnBatch) -> *const u32;
+        fn batch_city_count(batch: &PersonColumnBatch) -> usize;
+        fn batch_city_name(batch: &PersonColumnBatch, id: u32) -> &CxxString;
+    }
+
+    // ============================================================================
+    // MEMORY-MAPPED RECORD FILES - flat format defined in person_file.h
+    // Rust receives the raw mapping and parses the shared layout itself,
+    // so scanning a record makes zero C++ calls
+    // ============================================================================
+    unsafe extern "C++" {
+        include!("cpp-app/person_file.h");
+
+        type PersonFile;
+
+        fn person_file_record_count(file: &PersonFile) -> usize;
+        fn person_file_data_ptr(file: &PersonFile) -> *const u8;
+        fn person_file_size_bytes(file: &PersonFile) -> usize;
     }
 
     // ============================================================================
@@ -43,6 +87,84 @@ mod ffi {
         city: String,        // Extracted from nested C++ structs
     }
     
+    /// Flat snapshot of a Person and its nested ContactInfo/Address
+    /// Filled on the C++ side in one call, so Rust pays O(1) FFI
+    /// transitions per object instead of O(fields)
+    struct PersonSnapshot {
+        age: u32,
+        height: f64,
+        name: String,
+        city: String,
+        email: String,
+        phone: String,
+        postal_code: String,
+    }
+
+    /// Snapshot of the bridge instrumentation counters for this thread
+    /// All zeros unless built with the bridge-stats feature
+    struct BridgeStats {
+        crossings: u64,      // getter shims + instrumented entry points
+        entry_cycles: u64,   // rdtsc cycles spent inside entry points
+        string_bytes: u64,   // bytes of string data handed to Rust
+    }
+
+    /// PersonInfo variant that carries an interned city id instead of an
+    /// owned String - no per-record allocation, 4 bytes instead of a heap
+    /// string; resolve for display via city_dictionary_name
+    struct PersonInfoInterned {
+        is_adult: bool,
+        bmi_category: u8,    // 0=underweight, 1=normal, 2=overweight
+        name_length: usize,
+        city_id: u32,
+    }
+
+    /// Fixed-capacity inline string: 24 bytes cover >99.9% of city names
+    /// and postal codes with no heap allocation. len == 0xFF marks the
+    /// rare overflow case: bytes holds the first 24 bytes and the caller
+    /// should re-fetch through a String-returning API if it needs more.
+    struct InlineStr24 {
+        len: u8,
+        bytes: [u8; 24],
+    }
+
+    /// Trivially copyable PersonInfo: the city lives inline, so a
+    /// Vec<PersonInfoCompact> from a batch call is one flat memcpy-able
+    /// buffer instead of a vector of allocating structs
+    struct PersonInfoCompact {
+        is_adult: bool,
+        bmi_category: u8,    // 0=underweight, 1=normal, 2=overweight
+        name_length: usize,
+        city: InlineStr24,
+    }
+
+    /// Zero-copy PersonInfo variant: the city field is a pointer+length
+    /// view into the original C++ std::string storage (valid only while
+    /// the Person is alive and unmodified) - no allocation, no copy
+    struct PersonInfoView {
+        is_adult: bool,
+        bmi_category: u8,    // 0=underweight, 1=normal, 2=overweight
+        name_length: usize,
+        city_ptr: usize,     // points into the C++ Address's city string
+        city_len: usize,
+    }
+
+    /// Zero-copy HealthAnalysis variant: the recommendation is an id into
+    /// the canonical table (resolve via recommendation_text), so the
+    /// struct is a trivially copyable POD
+    struct HealthAnalysisView {
+        bmi: f64,
+        risk_score: f64,
+        recommendation_id: u8,
+        city_risk_factor: f64,
+    }
+
+    /// Columnar health results - one entry per row of a PersonColumnBatch
+    /// Plain contiguous columns, mirroring the input layout
+    struct HealthColumns {
+        bmis: Vec<f64>,
+        risk_scores: Vec<f64>,
+    }
+
     /// Health analysis result - new Rust functionality
     struct HealthAnalysis {
         bmi: f64,
@@ -51,6 +173,13 @@ mod ffi {
         city_risk_factor: f64,
     }
 
+    /// One finished async analysis from the completion ring; ticket
+    /// matches the value analysis_submit returned for the request
+    struct AnalysisCompletion {
+        ticket: u64,
+        analysis: HealthAnalysis,
+    }
+
     // ============================================================================
     // RUST FUNCTIONS - New functionality exposed to C++
     // These work with opaque C++ types and return bridge structs
@@ -72,7 +201,361 @@ mod ffi {
         
         /// Validate contact info - demonstrates deep access into nested C++ objects
         fn validate_contact(contact: &ContactInfo) -> bool;
+
+        /// Process many C++ Person objects in a single FFI crossing
+        /// Demonstrates: amortizing bridge overhead over a whole batch
+        /// Safety: `persons` must point to `count` valid `const Person*` entries
+        unsafe fn process_person_batch(persons: *const *const Person, count: usize) -> Vec<PersonInfo>;
+
+        /// Like process_person, but reads the object through one snapshot
+        /// crossing instead of seven individual getter calls
+        fn process_person_snapshot(person: &Person) -> PersonInfo;
+
+        /// Vectorized health analysis over a structure-of-arrays batch
+        /// The BMI and risk math runs over contiguous columns
+        fn analyze_health_columns(batch: &PersonColumnBatch) -> HealthColumns;
+
+        /// process_person variant returning an interned city id instead of
+        /// an allocated String - zero allocations per record
+        fn process_person_interned(person: &Person) -> PersonInfoInterned;
+
+        /// Risk factor for an interned city id - an array index into a
+        /// cached table instead of repeated string comparison
+        fn city_risk_by_id(id: u32) -> f64;
+
+        /// Load a "city,risk" CSV into an in-memory hash index built
+        /// once at startup; analyze_health then resolves risk in O(1)
+        /// with no per-record allocation. Returns entries loaded
+        /// (0 = file unreadable/empty; previous table kept)
+        fn load_city_risk_table(path: &str) -> usize;
+
+        /// Entries in the loaded risk index (0 = builtin fallback)
+        fn city_risk_table_size() -> usize;
+
+        /// Zero-copy process_person: the returned city view borrows the
+        /// C++ string storage instead of allocating a Rust String
+        fn process_person_view(person: &Person) -> PersonInfoView;
+
+        /// Zero-copy analyze_health: returns a POD with a recommendation
+        /// id instead of an allocated String
+        fn analyze_health_view(person: &Person, weight_kg: f64) -> HealthAnalysisView;
+
+        /// Canonical recommendation string for an id from the view API
+        fn recommendation_text(id: u8) -> &'static str;
+
+        /// Bulk BMI kernel over slices - one crossing, packed divides
+        /// into a caller-owned column; returns rows written
+        fn calculate_bmi_bulk(weights: &[f64], heights: &[f64], out: &mut [f64]) -> usize;
+
+        /// Bulk risk-score kernel: the analyze_health risk product over
+        /// columns (city risk precomputed via city_risk_by_id); returns
+        /// rows written
+        fn risk_score_bulk(
+            ages: &[u32],
+            bmis: &[f64],
+            city_risks: &[f64],
+            out: &mut [f64],
+        ) -> usize;
+
+        /// Health analysis over a memory-mapped record file - sequential
+        /// scan of flat records, no per-record objects or FFI calls
+        fn analyze_health_file(file: &PersonFile) -> HealthColumns;
+
+        /// Analyze a whole batch across a rayon thread pool - one FFI
+        /// crossing, all cores saturated on the Rust side
+        /// Safety: `persons` must point to `count` valid `const Person*`
+        /// entries; `weights` must hold one weight per person
+        unsafe fn analyze_health_parallel(
+            persons: *const *const Person,
+            count: usize,
+            weights: &[f64],
+        ) -> Vec<HealthAnalysis>;
+
+        /// Size the dedicated analysis thread pool (0 = rayon default);
+        /// returns false if the pool could not be built
+        fn set_analysis_threads(threads: usize) -> bool;
+
+        /// Enqueue an analysis without blocking: the snapshot is handed
+        /// to a Rust worker pool and a ticket comes back immediately, so
+        /// a reactor thread never stalls on the analysis itself.
+        /// Returns 0 if the request could not be queued.
+        fn analysis_submit(snapshot: PersonSnapshot, weight_kg: f64) -> u64;
+
+        /// Register an eventfd (or any writable fd) the workers bump by
+        /// one per completion, so an epoll/io_uring loop can await
+        /// results like any other event. Pass -1 to unregister. The fd
+        /// stays owned by the caller and must outlive its registration.
+        fn analysis_set_event_fd(fd: i32);
+
+        /// Drain the completion ring (non-blocking); completions may
+        /// arrive in any order, so match on ticket
+        fn analysis_poll_completions() -> Vec<AnalysisCompletion>;
+
+        /// Requests submitted but not yet drained from the completion ring
+        fn analysis_pending() -> usize;
+
+        /// Synchronous analyze_health over a captured snapshot - plain
+        /// data in, no Person needed (the shm server receives fields
+        /// from its rings, not objects)
+        fn analyze_snapshot(snap: &PersonSnapshot, weight_kg: f64) -> HealthAnalysis;
+
+        /// Canonical recommendation id for a risk score (an index into
+        /// the recommendation_text table)
+        fn recommendation_id(risk_score: f64) -> u8;
+
+        /// Size the warm-start cache behind analyze_health_cached
+        /// (rounded up to a power of two; 0 disables and clears it).
+        /// Returns the capacity now in effect.
+        fn set_analysis_cache_capacity(capacity: usize) -> usize;
+
+        /// analyze_health through a fixed-size memo cache keyed by
+        /// (age, height bucket, weight bucket, interned city). A hit
+        /// skips the risk math and string hashing; a miss computes via
+        /// the interned-city path and fills the slot.
+        fn analyze_health_cached(person: &Person, weight_kg: f64) -> HealthAnalysis;
+
+        /// Hits / misses counted since the cache was last (re)sized
+        fn analysis_cache_hits() -> u64;
+        fn analysis_cache_misses() -> u64;
+
+        /// Out-parameter variant of process_person: refills a caller-owned
+        /// result, reusing its string capacity instead of allocating
+        fn process_person_into(person: &Person, out: &mut PersonInfo);
+
+        /// Out-parameter variant of analyze_health - same reuse contract
+        fn analyze_health_into(person: &Person, weight_kg: f64, out: &mut HealthAnalysis);
+
+        /// Incremental analyze_health after an edit: `dirty` is the
+        /// Person::dirty_mask() of fields touched since `prev` was
+        /// computed (kDirty* bits in person.h), and only the outputs
+        /// those fields feed are recomputed - in particular the city
+        /// string traversal and risk lookup are skipped unless the city
+        /// changed. dirty == 0 returns prev unchanged.
+        fn refresh_analysis(
+            person: &Person,
+            prev: &HealthAnalysis,
+            weight_kg: f64,
+            dirty: u32,
+        ) -> HealthAnalysis;
+
+        /// Validate and report WHY: returns a failure bitmask (bit 0 =
+        /// email, 1 = phone, 2 = city, 3 = postal; 0 means valid) so
+        /// callers no longer re-validate in C++ to find the failing rule
+        fn validate_contact_detailed(contact: &ContactInfo) -> u32;
+
+        /// Batch variant: one crossing validates many contacts
+        /// Safety: `contacts` must point to `count` valid entries
+        unsafe fn validate_contact_batch(
+            contacts: *const *const ContactInfo,
+            count: usize,
+        ) -> Vec<u32>;
+
+        /// Packed batch validation: fields for the whole batch arrive
+        /// as one contiguous buffer plus an offsets array (4 per record
+        /// + trailing end; see ContactBatch in person.h) and are
+        /// scanned word-at-a-time with no getter calls - one bitmask
+        /// per record comes back
+        fn validate_contact_packed(bytes: &[u8], offsets: &[u32]) -> Vec<u32>;
+
+        /// Lazy process_person: only the fields requested in the mask
+        /// (bit 0 = is_adult, 1 = bmi_category, 2 = name_length,
+        /// 3 = city) are extracted; the rest stay at their defaults and
+        /// their getter chains are never walked
+        fn process_person_fields(person: &Person, field_mask: u32) -> PersonInfo;
+
+        /// Trivially copyable process_person: the city is stored inline
+        /// in the result (see InlineStr24), so nothing allocates on
+        /// either side of the bridge
+        fn process_person_compact(person: &Person) -> PersonInfoCompact;
+
+        /// Batch variant: the returned vector is one flat POD buffer that
+        /// C++ can index or memcpy directly, not N allocating structs
+        /// Safety: `persons` must point to `count` valid `const Person*` entries
+        unsafe fn process_person_batch_compact(
+            persons: *const *const Person,
+            count: usize,
+        ) -> Vec<PersonInfoCompact>;
+
+        /// True if this inline string was truncated on write (the source
+        /// exceeded 24 bytes); callers needing the full text should fall
+        /// back to process_person
+        fn inline_str_overflowed(s: &InlineStr24) -> bool;
+
+        /// This thread's bridge instrumentation counters (zeros unless
+        /// built with the bridge-stats feature)
+        fn get_bridge_stats() -> BridgeStats;
+
+        /// Reset this thread's bridge instrumentation counters
+        fn reset_bridge_stats();
+
+        /// Cumulative Rust-side heap counters for the allocation
+        /// scorecard (zeros unless built with the alloc-stats feature)
+        fn rust_alloc_count() -> u64;
+        fn rust_alloc_bytes() -> u64;
+    }
+}
+
+// ============================================================================
+// ALLOCATION TRACKING (alloc-stats feature)
+// A counting wrapper around the system allocator; the demo reads the
+// counters before and after each bridge call to print per-call heap
+// deltas. Global atomics rather than thread-locals: the allocator runs
+// before TLS is ready on new threads.
+// ============================================================================
+
+#[cfg(feature = "alloc-stats")]
+mod alloc_stats {
+    use std::alloc::{GlobalAlloc, Layout, System};
+    use std::sync::atomic::{AtomicU64, Ordering};
+
+    pub static ALLOC_COUNT: AtomicU64 = AtomicU64::new(0);
+    pub static ALLOC_BYTES: AtomicU64 = AtomicU64::new(0);
+
+    pub struct CountingAllocator;
+
+    unsafe impl GlobalAlloc for CountingAllocator {
+        unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+            ALLOC_COUNT.fetch_add(1, Ordering::Relaxed);
+            ALLOC_BYTES.fetch_add(layout.size() as u64, Ordering::Relaxed);
+            System.alloc(layout)
+        }
+
+        unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+            System.dealloc(ptr, layout)
+        }
+
+        unsafe fn alloc_zeroed(&self, layout: Layout) -> *mut u8 {
+            ALLOC_COUNT.fetch_add(1, Ordering::Relaxed);
+            ALLOC_BYTES.fetch_add(layout.size() as u64, Ordering::Relaxed);
+            System.alloc_zeroed(layout)
+        }
+
+        unsafe fn realloc(&self, ptr: *mut u8, layout: Layout, new_size: usize) -> *mut u8 {
+            ALLOC_COUNT.fetch_add(1, Ordering::Relaxed);
+            ALLOC_BYTES.fetch_add(new_size as u64, Ordering::Relaxed);
+            System.realloc(ptr, layout, new_size)
+        }
+    }
+
+    #[global_allocator]
+    static GLOBAL: CountingAllocator = CountingAllocator;
+}
+
+/// Cumulative Rust heap allocations (zero unless built with alloc-stats)
+fn rust_alloc_count() -> u64 {
+    #[cfg(feature = "alloc-stats")]
+    {
+        alloc_stats::ALLOC_COUNT.load(std::sync::atomic::Ordering::Relaxed)
+    }
+    #[cfg(not(feature = "alloc-stats"))]
+    {
+        0
+    }
+}
+
+/// Cumulative Rust heap bytes requested (zero unless built with alloc-stats)
+fn rust_alloc_bytes() -> u64 {
+    #[cfg(feature = "alloc-stats")]
+    {
+        alloc_stats::ALLOC_BYTES.load(std::sync::atomic::Ordering::Relaxed)
+    }
+    #[cfg(not(feature = "alloc-stats"))]
+    {
+        0
+    }
+}
+
+// ============================================================================
+// BRIDGE INSTRUMENTATION (bridge-stats feature)
+// Entry points create an EntryGuard; with the feature off it is a unit
+// type and everything below compiles away
+// ============================================================================
+
+mod bridge_stats {
+    #[cfg(feature = "bridge-stats")]
+    use std::cell::Cell;
+
+    #[cfg(feature = "bridge-stats")]
+    thread_local! {
+        static ENTRIES: Cell<u64> = const { Cell::new(0) };
+        static CYCLES: Cell<u64> = const { Cell::new(0) };
+    }
+
+    #[cfg(feature = "bridge-stats")]
+    fn now_cycles() -> u64 {
+        #[cfg(target_arch = "x86_64")]
+        unsafe {
+            core::arch::x86_64::_rdtsc()
+        }
+        #[cfg(not(target_arch = "x86_64"))]
+        {
+            // No cheap cycle counter - fall back to monotonic nanoseconds
+            use std::time::{SystemTime, UNIX_EPOCH};
+            SystemTime::now()
+                .duration_since(UNIX_EPOCH)
+                .map(|d| d.as_nanos() as u64)
+                .unwrap_or(0)
+        }
+    }
+
+    /// Counts one entry-point crossing and its cycles on drop
+    pub struct EntryGuard {
+        #[cfg(feature = "bridge-stats")]
+        start: u64,
+    }
+
+    pub fn entry() -> EntryGuard {
+        EntryGuard {
+            #[cfg(feature = "bridge-stats")]
+            start: now_cycles(),
+        }
     }
+
+    #[cfg(feature = "bridge-stats")]
+    impl Drop for EntryGuard {
+        fn drop(&mut self) {
+            let elapsed = now_cycles().wrapping_sub(self.start);
+            ENTRIES.with(|e| e.set(e.get() + 1));
+            CYCLES.with(|c| c.set(c.get() + elapsed));
+        }
+    }
+
+    /// (entry crossings, cumulative entry cycles) for this thread
+    pub fn snapshot() -> (u64, u64) {
+        #[cfg(feature = "bridge-stats")]
+        {
+            (ENTRIES.with(Cell::get), CYCLES.with(Cell::get))
+        }
+        #[cfg(not(feature = "bridge-stats"))]
+        {
+            (0, 0)
+        }
+    }
+
+    pub fn reset() {
+        #[cfg(feature = "bridge-stats")]
+        {
+            ENTRIES.with(|e| e.set(0));
+            CYCLES.with(|c| c.set(0));
+        }
+    }
+}
+
+/// This thread's bridge counters, merged across both sides: getter-shim
+/// counts come from C++ (person.cpp), entry counts from the Rust guards
+fn get_bridge_stats() -> ffi::BridgeStats {
+    let (entries, entry_cycles) = bridge_stats::snapshot();
+    ffi::BridgeStats {
+        crossings: entries + ffi::bridge_getter_crossings(),
+        entry_cycles,
+        string_bytes: ffi::bridge_string_bytes(),
+    }
+}
+
+/// Reset this thread's bridge counters on both sides
+fn reset_bridge_stats() {
+    bridge_stats::reset();
+    ffi::reset_bridge_getter_stats();
 }
 
 // ============================================================================
@@ -88,6 +571,7 @@ mod ffi {
 /// 3. Perform Rust logic
 /// 4. Return bridge struct with results
 fn process_person(person: &ffi::Person) -> ffi::PersonInfo {
+    let _entry = bridge_stats::entry();
     // Extract data from C++ object using getter functions
     let age = ffi::get_person_age(person);
     let height = ffi::get_person_height(person);
@@ -126,6 +610,183 @@ fn process_person(person: &ffi::Person) -> ffi::PersonInfo {
     }
 }
 
+/// Process a Person via a single snapshot crossing
+///
+/// `snapshot_person` copies all fields across the bridge at once, so the
+/// analysis below runs on plain Rust data with no further FFI calls -
+/// compare with `process_person`, which makes a getter call per field.
+fn process_person_snapshot(person: &ffi::Person) -> ffi::PersonInfo {
+    let _entry = bridge_stats::entry();
+    let snap = ffi::snapshot_person(person);
+
+    let is_adult = snap.age >= 18;
+
+    let assumed_weight_kg = 70.0;
+    let bmi = assumed_weight_kg / (snap.height * snap.height);
+
+    let bmi_category = if bmi < 18.5 {
+        0 // underweight
+    } else if bmi < 25.0 {
+        1 // normal
+    } else {
+        2 // overweight
+    };
+
+    ffi::PersonInfo {
+        is_adult,
+        bmi_category,
+        name_length: snap.name.len(),
+        city: snap.city,
+    }
+}
+
+// Field request bits for process_person_fields
+// (mirror these values in C++ callers that build the mask)
+const FIELD_IS_ADULT: u32 = 1 << 0;
+const FIELD_BMI_CATEGORY: u32 = 1 << 1;
+const FIELD_NAME_LENGTH: u32 = 1 << 2;
+const FIELD_CITY: u32 = 1 << 3;
+
+/// Lazy variant of process_person driven by a field request mask
+///
+/// process_person always walks the full Person -> ContactInfo -> Address
+/// chain - three pointer chases through separately allocated objects -
+/// even when the caller only wants is_adult and bmi_category. Here each
+/// getter (and in particular the deep, cache-hostile city traversal)
+/// runs only if its bit is requested; unrequested fields keep defaults.
+fn process_person_fields(person: &ffi::Person, field_mask: u32) -> ffi::PersonInfo {
+    let _entry = bridge_stats::entry();
+    let mut info = ffi::PersonInfo {
+        is_adult: false,
+        bmi_category: 0,
+        name_length: 0,
+        city: String::new(),
+    };
+
+    if field_mask & FIELD_IS_ADULT != 0 {
+        info.is_adult = ffi::get_person_age(person) >= 18;
+    }
+
+    if field_mask & FIELD_BMI_CATEGORY != 0 {
+        let height = ffi::get_person_height(person);
+        let assumed_weight_kg = 70.0;
+        let bmi = assumed_weight_kg / (height * height);
+        info.bmi_category = if bmi < 18.5 {
+            0 // underweight
+        } else if bmi < 25.0 {
+            1 // normal
+        } else {
+            2 // overweight
+        };
+    }
+
+    if field_mask & FIELD_NAME_LENGTH != 0 {
+        info.name_length = ffi::get_person_name(person)
+            .to_str()
+            .map(|s| s.len())
+            .unwrap_or(0);
+    }
+
+    if field_mask & FIELD_CITY != 0 {
+        // The deepest part of the traversal - only walked on request
+        let contact = ffi::get_person_contact(person);
+        let address = ffi::get_contact_address(contact);
+        let city = ffi::get_address_city(address);
+        info.city.push_str(city.to_str().unwrap_or("Unknown"));
+    }
+
+    info
+}
+
+/// Process a whole batch of C++ Person objects with one FFI crossing
+///
+/// Calling `process_person` in a loop pays one bridge transition per object;
+/// this entry point pays a single transition for the entire batch, so the
+/// per-call overhead amortizes over thousands of objects.
+///
+/// # Safety
+/// `persons` must point to `count` valid, non-null `const Person*` entries
+/// that stay alive for the duration of the call.
+unsafe fn process_person_batch(persons: *const *const ffi::Person, count: usize) -> Vec<ffi::PersonInfo> {
+    let _entry = bridge_stats::entry();
+    if persons.is_null() || count == 0 {
+        return Vec::new();
+    }
+
+    let slice = std::slice::from_raw_parts(persons, count);
+    slice.iter().map(|&p| process_person(&*p)).collect()
+}
+
+// Marker stored in InlineStr24.len when the source exceeded the 24-byte
+// capacity; bytes then holds the first 24 bytes of the text
+const INLINE_STR_OVERFLOW: u8 = 0xFF;
+
+/// Pack a str into a fixed 24-byte inline field, flagging overflow
+fn inline_str24(s: &str) -> ffi::InlineStr24 {
+    let mut out = ffi::InlineStr24 {
+        len: 0,
+        bytes: [0; 24],
+    };
+    let src = s.as_bytes();
+    let capacity = out.bytes.len();
+    if src.len() <= capacity {
+        out.bytes[..src.len()].copy_from_slice(src);
+        out.len = src.len() as u8;
+    } else {
+        out.bytes.copy_from_slice(&src[..capacity]);
+        out.len = INLINE_STR_OVERFLOW;
+    }
+    out
+}
+
+fn inline_str_overflowed(s: &ffi::InlineStr24) -> bool {
+    s.len == INLINE_STR_OVERFLOW
+}
+
+/// Trivially copyable process_person
+///
+/// Same snapshot-based extraction as process_person_snapshot, but the
+/// city lands in a fixed inline field instead of a heap String, so the
+/// result is a plain POD and the whole call allocates nothing.
+fn process_person_compact(person: &ffi::Person) -> ffi::PersonInfoCompact {
+    let _entry = bridge_stats::entry();
+    let snap = ffi::snapshot_person(person);
+
+    let assumed_weight_kg = 70.0;
+    let bmi = assumed_weight_kg / (snap.height * snap.height);
+    let bmi_category = if bmi < 18.5 {
+        0 // underweight
+    } else if bmi < 25.0 {
+        1 // normal
+    } else {
+        2 // overweight
+    };
+
+    ffi::PersonInfoCompact {
+        is_adult: snap.age >= 18,
+        bmi_category,
+        name_length: snap.name.len(),
+        city: inline_str24(&snap.city),
+    }
+}
+
+/// Batch process_person with POD results - one crossing in, one flat
+/// buffer out; contrast with process_person_batch, whose Vec<PersonInfo>
+/// still carries a heap-allocated city String per element
+/// Safety: see process_person_batch
+unsafe fn process_person_batch_compact(
+    persons: *const *const ffi::Person,
+    count: usize,
+) -> Vec<ffi::PersonInfoCompact> {
+    let _entry = bridge_stats::entry();
+    if persons.is_null() || count == 0 {
+        return Vec::new();
+    }
+
+    let slice = std::slice::from_raw_parts(persons, count);
+    slice.iter().map(|&p| process_person_compact(&*p)).collect()
+}
+
 /// Perform comprehensive health analysis
 /// 
 /// This demonstrates NEW Rust functionality that works with existing C++ types
@@ -134,6 +795,7 @@ fn process_person(person: &ffi::Person) -> ffi::PersonInfo {
 /// - Concurrent processing
 /// - Safe data validation
 fn analyze_health(person: &ffi::Person, weight_kg: f64) -> ffi::HealthAnalysis {
+    let _entry = bridge_stats::entry();
     // Extract data from C++ Person object
     let age = ffi::get_person_age(person);
     let height = ffi::get_person_height(person);
@@ -154,23 +816,13 @@ fn analyze_health(person: &ffi::Person, weight_kg: f64) -> ffi::HealthAnalysis {
     
     // City-based risk factor (demonstrating string processing)
     let city_str = city.to_str().unwrap_or("");
-    let city_risk = match city_str {
-        "New York" => 1.2,
-        "Los Angeles" => 1.1,
-        _ => 1.0,
-    };
+    let city_risk = city_risk_factor(city_str);
     
     let risk_score = age_risk * bmi_risk * city_risk;
-    
+
     // Generate recommendation based on analysis
-    let recommendation = if risk_score < 1.2 {
-        "Excellent health profile. Maintain current lifestyle.".to_string()
-    } else if risk_score < 1.5 {
-        "Good health. Consider minor lifestyle adjustments.".to_string()
-    } else {
-        "Elevated risk factors. Recommend consultation with healthcare provider.".to_string()
-    };
-    
+    let recommendation = RECOMMENDATIONS[recommendation_id(risk_score) as usize].to_string();
+
     ffi::HealthAnalysis {
         bmi,
         risk_score,
@@ -179,59 +831,1263 @@ fn analyze_health(person: &ffi::Person, weight_kg: f64) -> ffi::HealthAnalysis {
     }
 }
 
-/// Greet a person by name
-/// 
-/// Simple function demonstrating string handling
-fn greet_person(name: &str) -> usize {
-    if name.is_empty() {
-        println!("Hello, stranger!");
-        return 0;
+// Dirty-field bits set by the C++ setters (mirror the kDirty* constants
+// in cpp-app/person.h). Only the bits that gate expensive work are
+// named here; scalar fields like age are simply re-read.
+const DIRTY_HEIGHT: u32 = 1 << 1;
+const DIRTY_CITY: u32 = 1 << 6;
+const DIRTY_WEIGHT: u32 = 1 << 8;
+
+/// Incremental analyze_health driven by the setters' dirty mask
+///
+/// The expensive parts of a full recompute are the city getter chain
+/// (three pointer chases plus string hashing in city_risk_factor) and
+/// the recommendation string - both unrelated to a typical single-field
+/// edit. Scalars (age, height) are re-read unconditionally since those
+/// getters are direct member loads; the city risk is carried over from
+/// `prev` unless the city bit is set, and the BMI is carried over
+/// unless height or weight changed.
+fn refresh_analysis(
+    person: &ffi::Person,
+    prev: &ffi::HealthAnalysis,
+    weight_kg: f64,
+    dirty: u32,
+) -> ffi::HealthAnalysis {
+    if dirty == 0 {
+        return ffi::HealthAnalysis {
+            bmi: prev.bmi,
+            risk_score: prev.risk_score,
+            recommendation: prev.recommendation.clone(),
+            city_risk_factor: prev.city_risk_factor,
+        };
     }
-    
-    println!("Hello from Rust, {}!", name);
-    name.len()
-}
 
-/// Calculate BMI from weight and height
-/// 
-/// Pure Rust calculation - no C++ interaction
-fn calculate_bmi(weight_kg: f64, height_m: f64) -> f64 {
-    if height_m <= 0.0 {
-        return 0.0;
+    let bmi = if dirty & (DIRTY_HEIGHT | DIRTY_WEIGHT) != 0 {
+        let height = ffi::get_person_height(person);
+        if height > 0.0 {
+            weight_kg / (height * height)
+        } else {
+            0.0
+        }
+    } else {
+        prev.bmi
+    };
+
+    let city_risk = if dirty & DIRTY_CITY != 0 {
+        let contact = ffi::get_person_contact(person);
+        let address = ffi::get_contact_address(contact);
+        city_risk_factor(ffi::get_address_city(address).to_str().unwrap_or(""))
+    } else {
+        prev.city_risk_factor
+    };
+
+    // Age is a direct member load - cheaper to re-read than to track
+    let age = ffi::get_person_age(person);
+    let age_risk = if age < 18 || age > 65 { 1.5 } else { 1.0 };
+    let bmi_risk = if bmi < 18.5 || bmi > 25.0 { 1.3 } else { 1.0 };
+    let risk_score = age_risk * bmi_risk * city_risk;
+
+    // Reuse prev's recommendation buffer when the id didn't move
+    let id = recommendation_id(risk_score);
+    let recommendation = if id == recommendation_id(prev.risk_score) {
+        prev.recommendation.clone()
+    } else {
+        RECOMMENDATIONS[id as usize].to_string()
+    };
+
+    ffi::HealthAnalysis {
+        bmi,
+        risk_score,
+        recommendation,
+        city_risk_factor: city_risk,
     }
-    weight_kg / (height_m * height_m)
 }
 
-/// Validate contact information
-/// 
-/// Demonstrates deep access into nested C++ objects:
-/// ContactInfo -> Address -> fields
-fn validate_contact(contact: &ffi::ContactInfo) -> bool {
-    // Extract data from nested C++ objects
-    let email = ffi::get_contact_email(contact);
-    let phone = ffi::get_contact_phone(contact);
+/// Out-parameter variant of process_person
+///
+/// Writes into a caller-owned PersonInfo instead of constructing a new
+/// one. The city is rebuilt with clear() + push_str, so once the pooled
+/// result's string capacity has grown to fit, refills allocate nothing.
+fn process_person_into(person: &ffi::Person, out: &mut ffi::PersonInfo) {
+    let age = ffi::get_person_age(person);
+    let height = ffi::get_person_height(person);
+    let name = ffi::get_person_name(person);
+    let contact = ffi::get_person_contact(person);
     let address = ffi::get_contact_address(contact);
     let city = ffi::get_address_city(address);
-    let postal_code = ffi::get_address_postal_code(address);
-    
-    // Rust validation logic
-    let email_str = email.to_str().unwrap_or("");
-    let phone_str = phone.to_str().unwrap_or("");
-    let city_str = city.to_str().unwrap_or("");
-    let postal_str = postal_code.to_str().unwrap_or("");
-    
-    // Simple validation rules
-    let email_valid = email_str.contains('@') && email_str.len() > 3;
-    let phone_valid = phone_str.len() >= 7;
-    let city_valid = !city_str.is_empty();
-    let postal_valid = postal_str.len() >= 5;
-    
-    email_valid && phone_valid && city_valid && postal_valid
-}
 
-// ============================================================================
-// TESTS
-// ============================================================================
+    let assumed_weight_kg = 70.0;
+    let bmi = assumed_weight_kg / (height * height);
+
+    out.is_adult = age >= 18;
+    out.bmi_category = if bmi < 18.5 {
+        0 // underweight
+    } else if bmi < 25.0 {
+        1 // normal
+    } else {
+        2 // overweight
+    };
+    out.name_length = name.to_str().map(|s| s.len()).unwrap_or(0);
+    out.city.clear();
+    out.city.push_str(city.to_str().unwrap_or("Unknown"));
+}
+
+/// Out-parameter variant of analyze_health
+///
+/// Same math as analyze_health; the recommendation string is refilled in
+/// place so a pooled result reaches zero allocations per record
+fn analyze_health_into(person: &ffi::Person, weight_kg: f64, out: &mut ffi::HealthAnalysis) {
+    let age = ffi::get_person_age(person);
+    let height = ffi::get_person_height(person);
+    let contact = ffi::get_person_contact(person);
+    let address = ffi::get_contact_address(contact);
+    let city = ffi::get_address_city(address);
+
+    let bmi = if height > 0.0 {
+        weight_kg / (height * height)
+    } else {
+        0.0
+    };
+
+    let age_risk = if age < 18 || age > 65 { 1.5 } else { 1.0 };
+    let bmi_risk = if bmi < 18.5 || bmi > 25.0 { 1.3 } else { 1.0 };
+    let city_risk = city_risk_factor(city.to_str().unwrap_or(""));
+    let risk_score = age_risk * bmi_risk * city_risk;
+
+    out.bmi = bmi;
+    out.risk_score = risk_score;
+    out.city_risk_factor = city_risk;
+    out.recommendation.clear();
+    out.recommendation
+        .push_str(RECOMMENDATIONS[recommendation_id(risk_score) as usize]);
+}
+
+/// Canonical recommendation strings, addressed by id
+///
+/// The view API returns an id into this fixed table so results stay
+/// allocation-free; C++ resolves the text via recommendation_text
+const RECOMMENDATIONS: [&str; 3] = [
+    "Excellent health profile. Maintain current lifestyle.",
+    "Good health. Consider minor lifestyle adjustments.",
+    "Elevated risk factors. Recommend consultation with healthcare provider.",
+];
+
+/// Map a risk score to the canonical recommendation id
+fn recommendation_id(risk_score: f64) -> u8 {
+    if risk_score < 1.2 {
+        0
+    } else if risk_score < 1.5 {
+        1
+    } else {
+        2
+    }
+}
+
+/// Canonical recommendation string for an id from the view API
+fn recommendation_text(id: u8) -> &'static str {
+    RECOMMENDATIONS.get(id as usize).copied().unwrap_or("")
+}
+
+/// Zero-copy variant of process_person
+///
+/// The city comes back as a pointer+length view into the C++ Address's
+/// std::string storage - two allocations and two copies saved per record.
+/// The view stays valid only while the Person is alive and unmodified.
+fn process_person_view(person: &ffi::Person) -> ffi::PersonInfoView {
+    let age = ffi::get_person_age(person);
+    let height = ffi::get_person_height(person);
+    let name = ffi::get_person_name(person);
+    let contact = ffi::get_person_contact(person);
+    let address = ffi::get_contact_address(contact);
+    let city = ffi::get_address_city(address);
+
+    let assumed_weight_kg = 70.0;
+    let bmi = assumed_weight_kg / (height * height);
+
+    let bmi_category = if bmi < 18.5 {
+        0 // underweight
+    } else if bmi < 25.0 {
+        1 // normal
+    } else {
+        2 // overweight
+    };
+
+    let city_bytes = city.as_bytes();
+    ffi::PersonInfoView {
+        is_adult: age >= 18,
+        bmi_category,
+        name_length: name.to_str().map(|s| s.len()).unwrap_or(0),
+        city_ptr: city_bytes.as_ptr() as usize,
+        city_len: city_bytes.len(),
+    }
+}
+
+/// Zero-copy variant of analyze_health
+///
+/// Same math as analyze_health, but the result is a trivially copyable
+/// POD: the recommendation travels as an id into the canonical table
+fn analyze_health_view(person: &ffi::Person, weight_kg: f64) -> ffi::HealthAnalysisView {
+    let age = ffi::get_person_age(person);
+    let height = ffi::get_person_height(person);
+    let contact = ffi::get_person_contact(person);
+    let address = ffi::get_contact_address(contact);
+    let city = ffi::get_address_city(address);
+
+    let bmi = if height > 0.0 {
+        weight_kg / (height * height)
+    } else {
+        0.0
+    };
+
+    let age_risk = if age < 18 || age > 65 { 1.5 } else { 1.0 };
+    let bmi_risk = if bmi < 18.5 || bmi > 25.0 { 1.3 } else { 1.0 };
+    let city_risk = city_risk_factor(city.to_str().unwrap_or(""));
+    let risk_score = age_risk * bmi_risk * city_risk;
+
+    ffi::HealthAnalysisView {
+        bmi,
+        risk_score,
+        recommendation_id: recommendation_id(risk_score),
+        city_risk_factor: city_risk,
+    }
+}
+
+/// process_person variant built on the city interning dictionary
+///
+/// Instead of allocating a fresh String for the city of every record,
+/// the city is interned once in the shared C++ CityDictionary and the
+/// result carries the dense u32 id
+fn process_person_interned(person: &ffi::Person) -> ffi::PersonInfoInterned {
+    let age = ffi::get_person_age(person);
+    let height = ffi::get_person_height(person);
+    let name = ffi::get_person_name(person);
+    let contact = ffi::get_person_contact(person);
+    let address = ffi::get_contact_address(contact);
+    let city = ffi::get_address_city(address);
+
+    let assumed_weight_kg = 70.0;
+    let bmi = assumed_weight_kg / (height * height);
+
+    let bmi_category = if bmi < 18.5 {
+        0 // underweight
+    } else if bmi < 25.0 {
+        1 // normal
+    } else {
+        2 // overweight
+    };
+
+    ffi::PersonInfoInterned {
+        is_adult: age >= 18,
+        bmi_category,
+        name_length: name.to_str().map(|s| s.len()).unwrap_or(0),
+        city_id: ffi::intern_city(city),
+    }
+}
+
+// Memoized per-interned-id risk factors; cleared whenever a new risk
+// table is loaded so stale factors are re-derived on next use
+static RISK_BY_ID: std::sync::Mutex<Vec<f64>> = std::sync::Mutex::new(Vec::new());
+
+/// Risk factor for an interned city id
+///
+/// Lazily caches the per-id risk factor the first time an id is seen,
+/// so steady-state lookups are a bounds-checked array index with no
+/// string comparison or allocation
+fn city_risk_by_id(id: u32) -> f64 {
+    let idx = id as usize;
+    if idx >= ffi::city_dictionary_size() {
+        return 1.0; // id not in the dictionary - neutral risk
+    }
+
+    let mut table = RISK_BY_ID.lock().unwrap();
+    while table.len() <= idx {
+        let name = ffi::city_dictionary_name(table.len() as u32);
+        table.push(city_risk_factor(name.to_str().unwrap_or("")));
+    }
+    table[idx]
+}
+
+// Lane width for the bulk kernels below: 4 f64 per 256-bit vector
+// register, and the fixed-size chunks hand LLVM exact-trip-count inner
+// loops it turns into packed instructions. (Explicit std::simd would
+// need nightly; this is the stable equivalent.)
+const KERNEL_LANES: usize = 4;
+
+/// Bulk BMI kernel: one crossing computes a whole column
+///
+/// Versus one bridge call per calculate_bmi, this divides 4 lanes per
+/// instruction into a caller-owned slice and allocates nothing.
+/// Returns rows written: min of the three slice lengths.
+fn calculate_bmi_bulk(weights: &[f64], heights: &[f64], out: &mut [f64]) -> usize {
+    let n = weights.len().min(heights.len()).min(out.len());
+    let (weights, heights, out) = (&weights[..n], &heights[..n], &mut out[..n]);
+
+    let mut weight_chunks = weights.chunks_exact(KERNEL_LANES);
+    let mut height_chunks = heights.chunks_exact(KERNEL_LANES);
+    let mut out_chunks = out.chunks_exact_mut(KERNEL_LANES);
+    for ((w, h), o) in (&mut weight_chunks).zip(&mut height_chunks).zip(&mut out_chunks) {
+        for lane in 0..KERNEL_LANES {
+            // Branch-free select so the lane loop stays packed
+            let hh = h[lane] * h[lane];
+            o[lane] = if hh > 0.0 { w[lane] / hh } else { 0.0 };
+        }
+    }
+    for ((&w, &h), o) in weight_chunks
+        .remainder()
+        .iter()
+        .zip(height_chunks.remainder())
+        .zip(out_chunks.into_remainder())
+    {
+        let hh = h * h;
+        *o = if hh > 0.0 { w / hh } else { 0.0 };
+    }
+    n
+}
+
+/// Bulk risk-score kernel: the analyze_health risk product over columns
+///
+/// Takes city risk as a precomputed column (see city_risk_by_id) so the
+/// kernel is pure arithmetic: the age and BMI penalties become
+/// branch-free selects and the product runs 4 lanes per instruction.
+/// Returns rows written: min of the four slice lengths.
+fn risk_score_bulk(ages: &[u32], bmis: &[f64], city_risks: &[f64], out: &mut [f64]) -> usize {
+    let n = ages
+        .len()
+        .min(bmis.len())
+        .min(city_risks.len())
+        .min(out.len());
+    for i in 0..n {
+        let age_risk = if ages[i] < 18 || ages[i] > 65 { 1.5 } else { 1.0 };
+        let bmi_risk = if bmis[i] < 18.5 || bmis[i] > 25.0 { 1.3 } else { 1.0 };
+        out[i] = age_risk * bmi_risk * city_risks[i];
+    }
+    n
+}
+
+/// Compute a BMI column from weight and height columns
+///
+/// Pure columnar arithmetic over contiguous slices - the simple loop
+/// body lets the compiler auto-vectorize the divides
+fn bmi_column(weights: &[f64], heights: &[f64]) -> Vec<f64> {
+    weights
+        .iter()
+        .zip(heights)
+        .map(|(&w, &h)| if h > 0.0 { w / (h * h) } else { 0.0 })
+        .collect()
+}
+
+/// Compute a risk-score column from age, BMI, and interned city columns
+///
+/// `city_risk_by_id` maps dense city id -> risk factor, so the per-row
+/// work is an array index instead of a string comparison
+fn risk_score_column(
+    ages: &[u32],
+    bmis: &[f64],
+    city_ids: &[u32],
+    city_risk_by_id: &[f64],
+) -> Vec<f64> {
+    ages.iter()
+        .zip(bmis)
+        .zip(city_ids)
+        .map(|((&age, &bmi), &city_id)| {
+            let age_risk = if age < 18 || age > 65 { 1.5 } else { 1.0 };
+            let bmi_risk = if bmi < 18.5 || bmi > 25.0 { 1.3 } else { 1.0 };
+            let city_risk = city_risk_by_id.get(city_id as usize).copied().unwrap_or(1.0);
+            age_risk * bmi_risk * city_risk
+        })
+        .collect()
+}
+
+// Risk index loaded from disk; None means the builtin fallback table
+// below is in effect. Built once at load, then read-shared by every
+// analysis path.
+static CITY_RISK_INDEX: std::sync::RwLock<Option<std::collections::HashMap<String, f64>>> =
+    std::sync::RwLock::new(None);
+
+/// Parse a "city,risk" table: one entry per line, '#' comments and
+/// malformed lines skipped. Split on the last comma so city names
+/// containing commas survive.
+fn parse_risk_table(text: &str) -> std::collections::HashMap<String, f64> {
+    let mut table = std::collections::HashMap::new();
+    for line in text.lines() {
+        let line = line.trim();
+        if line.is_empty() || line.starts_with('#') {
+            continue;
+        }
+        if let Some((city, risk)) = line.rsplit_once(',') {
+            if let Ok(risk) = risk.trim().parse::<f64>() {
+                table.insert(city.trim().to_string(), risk);
+            }
+        }
+    }
+    table
+}
+
+/// Load a city-risk table from disk, replacing the builtin 3-city match
+///
+/// The file is parsed once into a hash index, so every subsequent
+/// analyze_health call resolves risk with a single O(1) hash lookup and
+/// no allocation. Returns the number of entries loaded; 0 means the
+/// file could not be read (or held no valid entries) and the previous
+/// table stays in effect.
+fn load_city_risk_table(path: &str) -> usize {
+    let text = match std::fs::read_to_string(path) {
+        Ok(text) => text,
+        Err(_) => return 0,
+    };
+    let table = parse_risk_table(&text);
+    let count = table.len();
+    if count == 0 {
+        return 0;
+    }
+    *CITY_RISK_INDEX.write().unwrap() = Some(table);
+    // Per-id memo was derived from the old table - rebuild lazily
+    RISK_BY_ID.lock().unwrap().clear();
+    count
+}
+
+/// Number of entries in the loaded risk index (0 = builtin fallback)
+fn city_risk_table_size() -> usize {
+    CITY_RISK_INDEX
+        .read()
+        .unwrap()
+        .as_ref()
+        .map(|table| table.len())
+        .unwrap_or(0)
+}
+
+/// Risk factor for a city name (same table as analyze_health)
+///
+/// Consults the loaded risk index first; the hard-coded arms below are
+/// the fallback when no table has been loaded (or for cities absent
+/// from it)
+fn city_risk_factor(city: &str) -> f64 {
+    if let Some(table) = CITY_RISK_INDEX.read().unwrap().as_ref() {
+        if let Some(&risk) = table.get(city) {
+            return risk;
+        }
+    }
+    match city {
+        "New York" => 1.2,
+        "Los Angeles" => 1.1,
+        _ => 1.0,
+    }
+}
+
+/// Vectorized health analysis over a PersonColumnBatch
+///
+/// Reads each column once through the bridge, resolves city risk per
+/// interned id (O(distinct cities) string work instead of O(rows)),
+/// then runs the BMI and risk math over contiguous arrays
+fn analyze_health_columns(batch: &ffi::PersonColumnBatch) -> ffi::HealthColumns {
+    let n = ffi::batch_size(batch);
+    if n == 0 {
+        return ffi::HealthColumns {
+            bmis: Vec::new(),
+            risk_scores: Vec::new(),
+        };
+    }
+
+    // Safety: the pointers come straight from the batch's vectors and the
+    // batch outlives this call; n matches the column lengths
+    let (ages, heights, weights, city_ids) = unsafe {
+        (
+            std::slice::from_raw_parts(ffi::batch_ages_ptr(batch), n),
+            std::slice::from_raw_parts(ffi::batch_heights_ptr(batch), n),
+            std::slice::from_raw_parts(ffi::batch_weights_ptr(batch), n),
+            std::slice::from_raw_parts(ffi::batch_city_ids_ptr(batch), n),
+        )
+    };
+
+    // One string lookup per distinct city, not per row
+    let city_risk_by_id: Vec<f64> = (0..ffi::batch_city_count(batch))
+        .map(|id| city_risk_factor(ffi::batch_city_name(batch, id as u32).to_str().unwrap_or("")))
+        .collect();
+
+    let bmis = bmi_column(weights, heights);
+    let risk_scores = risk_score_column(ages, &bmis, city_ids, &city_risk_by_id);
+
+    ffi::HealthColumns { bmis, risk_scores }
+}
+
+// ============================================================================
+// PARALLEL ANALYSIS ENGINE
+// The analysis functions only read through const getters, so a batch is
+// embarrassingly parallel - C++ pays one crossing and rayon fans out
+// ============================================================================
+
+use std::sync::{Arc, Mutex};
+
+/// Dedicated analysis pool; falls back to rayon's global pool until
+/// set_analysis_threads installs one
+static ANALYSIS_POOL: Mutex<Option<Arc<rayon::ThreadPool>>> = Mutex::new(None);
+
+/// Shares the batch's pointer array across worker threads
+///
+/// Safety: the analysis functions only read the pointed-to Persons via
+/// const getters, and the caller guarantees the objects outlive the call
+struct SharedPersonList<'a>(&'a [*const ffi::Person]);
+unsafe impl Sync for SharedPersonList<'_> {}
+
+impl SharedPersonList<'_> {
+    fn get(&self, index: usize) -> *const ffi::Person {
+        self.0[index]
+    }
+}
+
+/// Size the dedicated analysis thread pool (0 = rayon default)
+fn set_analysis_threads(threads: usize) -> bool {
+    match rayon::ThreadPoolBuilder::new().num_threads(threads).build() {
+        Ok(pool) => {
+            *ANALYSIS_POOL.lock().unwrap() = Some(Arc::new(pool));
+            true
+        }
+        Err(_) => false,
+    }
+}
+
+/// Analyze a whole batch across the rayon thread pool
+///
+/// One bridge transition covers the batch; the per-person work is then
+/// distributed over all configured cores on the Rust side.
+///
+/// # Safety
+/// `persons` must point to `count` valid, non-null `const Person*`
+/// entries that stay alive (and unmodified) for the duration of the call.
+unsafe fn analyze_health_parallel(
+    persons: *const *const ffi::Person,
+    count: usize,
+    weights: &[f64],
+) -> Vec<ffi::HealthAnalysis> {
+    use rayon::prelude::*;
+
+    let n = count.min(weights.len());
+    if persons.is_null() || n == 0 {
+        return Vec::new();
+    }
+
+    let list = SharedPersonList(std::slice::from_raw_parts(persons, n));
+    let run = || {
+        (0..n)
+            .into_par_iter()
+            .map(|i| analyze_health(unsafe { &*list.get(i) }, weights[i]))
+            .collect()
+    };
+
+    let pool = ANALYSIS_POOL.lock().unwrap().clone();
+    match pool {
+        Some(pool) => pool.install(run),
+        None => run(),
+    }
+}
+
+// ============================================================================
+// WARM-START ANALYSIS CACHE
+// Population data is heavily clustered: a few thousand distinct
+// (age, height, city, weight) combinations cover most records, so a
+// small fixed-size memo table answers the bulk of analyze_health calls
+// without redoing the risk math. Open addressing with linear probing
+// and a short probe window; collisions past the window overwrite (it is
+// a cache, not a map).
+// ============================================================================
+
+mod analysis_cache {
+    use std::hash::{Hash, Hasher};
+    use std::sync::atomic::{AtomicU64, Ordering};
+    use std::sync::Mutex;
+
+    /// Bucketed lookup key: height in whole centimetres and weight in
+    /// whole kilograms, so measurement jitter lands in the same slot
+    #[derive(Clone, Copy, PartialEq, Eq, Hash)]
+    pub struct Key {
+        pub age: u32,
+        pub height_cm: u32,
+        pub weight_kg: u32,
+        pub city_id: u32,
+    }
+
+    /// Cached numeric results; the recommendation is stored as its
+    /// canonical id so slots stay Copy and fixed-size
+    #[derive(Clone, Copy)]
+    pub struct Value {
+        pub bmi: f64,
+        pub risk_score: f64,
+        pub city_risk_factor: f64,
+        pub recommendation_id: u8,
+    }
+
+    #[derive(Clone, Copy)]
+    struct Slot {
+        used: bool,
+        key: Key,
+        value: Value,
+    }
+
+    const EMPTY_SLOT: Slot = Slot {
+        used: false,
+        key: Key {
+            age: 0,
+            height_cm: 0,
+            weight_kg: 0,
+            city_id: 0,
+        },
+        value: Value {
+            bmi: 0.0,
+            risk_score: 0.0,
+            city_risk_factor: 0.0,
+            recommendation_id: 0,
+        },
+    };
+
+    // Probe window before giving up (lookup) or overwriting (insert)
+    const MAX_PROBE: usize = 8;
+
+    static SLOTS: Mutex<Vec<Slot>> = Mutex::new(Vec::new());
+    static HITS: AtomicU64 = AtomicU64::new(0);
+    static MISSES: AtomicU64 = AtomicU64::new(0);
+
+    fn slot_index(key: &Key, len: usize) -> usize {
+        let mut hasher = std::collections::hash_map::DefaultHasher::new();
+        key.hash(&mut hasher);
+        (hasher.finish() as usize) & (len - 1)
+    }
+
+    pub fn set_capacity(capacity: usize) -> usize {
+        let capacity = if capacity == 0 {
+            0
+        } else {
+            capacity.next_power_of_two()
+        };
+        *SLOTS.lock().unwrap() = vec![EMPTY_SLOT; capacity];
+        HITS.store(0, Ordering::Relaxed);
+        MISSES.store(0, Ordering::Relaxed);
+        capacity
+    }
+
+    pub fn get(key: &Key) -> Option<Value> {
+        let slots = SLOTS.lock().unwrap();
+        if slots.is_empty() {
+            return None;
+        }
+        let mask = slots.len() - 1;
+        let home = slot_index(key, slots.len());
+        for probe in 0..MAX_PROBE.min(slots.len()) {
+            let slot = &slots[(home + probe) & mask];
+            if slot.used && slot.key == *key {
+                HITS.fetch_add(1, Ordering::Relaxed);
+                return Some(slot.value);
+            }
+            if !slot.used {
+                break;
+            }
+        }
+        MISSES.fetch_add(1, Ordering::Relaxed);
+        None
+    }
+
+    pub fn insert(key: Key, value: Value) {
+        let mut slots = SLOTS.lock().unwrap();
+        if slots.is_empty() {
+            return;
+        }
+        let mask = slots.len() - 1;
+        let home = slot_index(&key, slots.len());
+        // First free (or matching) slot in the window, else overwrite home
+        let mut target = home;
+        for probe in 0..MAX_PROBE.min(slots.len()) {
+            let index = (home + probe) & mask;
+            if !slots[index].used || slots[index].key == key {
+                target = index;
+                break;
+            }
+        }
+        slots[target] = Slot {
+            used: true,
+            key,
+            value,
+        };
+    }
+
+    pub fn hits() -> u64 {
+        HITS.load(Ordering::Relaxed)
+    }
+
+    pub fn misses() -> u64 {
+        MISSES.load(Ordering::Relaxed)
+    }
+}
+
+fn set_analysis_cache_capacity(capacity: usize) -> usize {
+    analysis_cache::set_capacity(capacity)
+}
+
+/// analyze_health with warm-start memoization
+///
+/// The key costs two scalar getters, the city getter chain, and one
+/// interning hash; a hit then skips the risk computation entirely and
+/// rebuilds the recommendation from the canonical table. Misses compute
+/// through city_risk_by_id (no string hashing for already-seen cities)
+/// and fill the slot. With the cache disabled every call is a miss.
+fn analyze_health_cached(person: &ffi::Person, weight_kg: f64) -> ffi::HealthAnalysis {
+    let age = ffi::get_person_age(person);
+    let height = ffi::get_person_height(person);
+    let contact = ffi::get_person_contact(person);
+    let address = ffi::get_contact_address(contact);
+    let city_id = ffi::intern_city(ffi::get_address_city(address));
+
+    let key = analysis_cache::Key {
+        age,
+        height_cm: (height * 100.0).round() as u32,
+        weight_kg: weight_kg.round() as u32,
+        city_id,
+    };
+
+    if let Some(value) = analysis_cache::get(&key) {
+        return ffi::HealthAnalysis {
+            bmi: value.bmi,
+            risk_score: value.risk_score,
+            recommendation: RECOMMENDATIONS[value.recommendation_id as usize].to_string(),
+            city_risk_factor: value.city_risk_factor,
+        };
+    }
+
+    let bmi = if height > 0.0 {
+        weight_kg / (height * height)
+    } else {
+        0.0
+    };
+    let age_risk = if age < 18 || age > 65 { 1.5 } else { 1.0 };
+    let bmi_risk = if bmi < 18.5 || bmi > 25.0 { 1.3 } else { 1.0 };
+    let city_risk = city_risk_by_id(city_id);
+    let risk_score = age_risk * bmi_risk * city_risk;
+    let id = recommendation_id(risk_score);
+
+    analysis_cache::insert(
+        key,
+        analysis_cache::Value {
+            bmi,
+            risk_score,
+            city_risk_factor: city_risk,
+            recommendation_id: id,
+        },
+    );
+
+    ffi::HealthAnalysis {
+        bmi,
+        risk_score,
+        recommendation: RECOMMENDATIONS[id as usize].to_string(),
+        city_risk_factor: city_risk,
+    }
+}
+
+fn analysis_cache_hits() -> u64 {
+    analysis_cache::hits()
+}
+
+fn analysis_cache_misses() -> u64 {
+    analysis_cache::misses()
+}
+
+// ============================================================================
+// ASYNC SUBMISSION API
+// C++ enqueues snapshots without blocking; a small worker pool drains
+// the queue and parks results in a completion ring. An optional eventfd
+// registered from C++ is bumped once per completion so a reactor can
+// await results instead of polling.
+// ============================================================================
+
+mod async_analysis {
+    use std::collections::VecDeque;
+    use std::sync::atomic::{AtomicI32, AtomicU64, Ordering};
+    use std::sync::{mpsc, Arc, Mutex, OnceLock};
+
+    use crate::ffi;
+
+    // Worker threads draining the submission queue; analysis is cheap,
+    // so two are plenty - the point is decoupling, not parallelism
+    // (use analyze_health_parallel for throughput)
+    const WORKERS: usize = 2;
+
+    pub struct Job {
+        pub ticket: u64,
+        pub snapshot: ffi::PersonSnapshot,
+        pub weight_kg: f64,
+    }
+
+    static EVENT_FD: AtomicI32 = AtomicI32::new(-1);
+    static NEXT_TICKET: AtomicU64 = AtomicU64::new(1);
+    static PENDING: AtomicU64 = AtomicU64::new(0);
+    static COMPLETIONS: Mutex<VecDeque<ffi::AnalysisCompletion>> = Mutex::new(VecDeque::new());
+
+    /// Submission side of the worker queue; the pool spins up lazily on
+    /// first use. mpsc matches the API shape: any thread may submit,
+    /// one pool consumes.
+    fn sender() -> &'static Mutex<mpsc::Sender<Job>> {
+        static SENDER: OnceLock<Mutex<mpsc::Sender<Job>>> = OnceLock::new();
+        SENDER.get_or_init(|| {
+            let (tx, rx) = mpsc::channel::<Job>();
+            let rx = Arc::new(Mutex::new(rx));
+            for _ in 0..WORKERS {
+                let rx = Arc::clone(&rx);
+                std::thread::spawn(move || loop {
+                    let job = rx.lock().unwrap().recv();
+                    let job = match job {
+                        Ok(job) => job,
+                        Err(_) => break, // sender gone - library unloading
+                    };
+                    let analysis = crate::analyze_snapshot(&job.snapshot, job.weight_kg);
+                    COMPLETIONS.lock().unwrap().push_back(ffi::AnalysisCompletion {
+                        ticket: job.ticket,
+                        analysis,
+                    });
+                    signal_event_fd();
+                });
+            }
+            Mutex::new(tx)
+        })
+    }
+
+    /// Bump a registered eventfd by one so a blocked reactor wakes up
+    fn signal_event_fd() {
+        let fd = EVENT_FD.load(Ordering::Acquire);
+        if fd < 0 {
+            return;
+        }
+        #[cfg(unix)]
+        {
+            use std::fs::File;
+            use std::io::Write;
+            use std::mem::ManuallyDrop;
+            use std::os::unix::io::FromRawFd;
+            // Borrow the caller's fd without taking ownership -
+            // ManuallyDrop keeps File's Drop from closing it
+            let mut file = ManuallyDrop::new(unsafe { File::from_raw_fd(fd) });
+            let _ = file.write_all(&1u64.to_ne_bytes());
+        }
+    }
+
+    pub fn submit(snapshot: ffi::PersonSnapshot, weight_kg: f64) -> u64 {
+        let ticket = NEXT_TICKET.fetch_add(1, Ordering::Relaxed);
+        let sent = sender().lock().unwrap().send(Job {
+            ticket,
+            snapshot,
+            weight_kg,
+        });
+        match sent {
+            Ok(()) => {
+                PENDING.fetch_add(1, Ordering::Relaxed);
+                ticket
+            }
+            Err(_) => 0, // every worker died - nothing will complete this
+        }
+    }
+
+    pub fn set_event_fd(fd: i32) {
+        EVENT_FD.store(fd, Ordering::Release);
+    }
+
+    pub fn poll_completions() -> Vec<ffi::AnalysisCompletion> {
+        let drained: Vec<_> = COMPLETIONS.lock().unwrap().drain(..).collect();
+        PENDING.fetch_sub(drained.len() as u64, Ordering::Relaxed);
+        drained
+    }
+
+    pub fn pending() -> usize {
+        PENDING.load(Ordering::Relaxed) as usize
+    }
+}
+
+/// analyze_health over an already-captured snapshot - the same math,
+/// but no FFI calls, so it can run on a worker thread that never
+/// touches the C++ object graph
+fn analyze_snapshot(snap: &ffi::PersonSnapshot, weight_kg: f64) -> ffi::HealthAnalysis {
+    let bmi = if snap.height > 0.0 {
+        weight_kg / (snap.height * snap.height)
+    } else {
+        0.0
+    };
+    let age_risk = if snap.age < 18 || snap.age > 65 { 1.5 } else { 1.0 };
+    let bmi_risk = if bmi < 18.5 || bmi > 25.0 { 1.3 } else { 1.0 };
+    let city_risk = city_risk_factor(&snap.city);
+    let risk_score = age_risk * bmi_risk * city_risk;
+
+    ffi::HealthAnalysis {
+        bmi,
+        risk_score,
+        recommendation: RECOMMENDATIONS[recommendation_id(risk_score) as usize].to_string(),
+        city_risk_factor: city_risk,
+    }
+}
+
+fn analysis_submit(snapshot: ffi::PersonSnapshot, weight_kg: f64) -> u64 {
+    async_analysis::submit(snapshot, weight_kg)
+}
+
+fn analysis_set_event_fd(fd: i32) {
+    async_analysis::set_event_fd(fd);
+}
+
+fn analysis_poll_completions() -> Vec<ffi::AnalysisCompletion> {
+    async_analysis::poll_completions()
+}
+
+fn analysis_pending() -> usize {
+    async_analysis::pending()
+}
+
+// ============================================================================
+// MEMORY-MAPPED RECORD FILE SCAN
+// Layout constants mirror person_file.h - bump the version there on change
+// ============================================================================
+
+const PERSON_FILE_MAGIC: u32 = 0x4E53_5250; // "PRSN"
+const PERSON_FILE_VERSION: u32 = 1;
+const PERSON_FILE_HEADER_SIZE: usize = 24;
+const PERSON_FILE_RECORD_SIZE: usize = 64;
+
+fn read_u32(data: &[u8], offset: usize) -> u32 {
+    u32::from_le_bytes(data[offset..offset + 4].try_into().unwrap())
+}
+
+fn read_u64(data: &[u8], offset: usize) -> u64 {
+    u64::from_le_bytes(data[offset..offset + 8].try_into().unwrap())
+}
+
+fn read_f64(data: &[u8], offset: usize) -> f64 {
+    f64::from_le_bytes(data[offset..offset + 8].try_into().unwrap())
+}
+
+/// Scan a person record file image and compute health columns
+///
+/// Pure function over the raw bytes (testable without mmap): walks the
+/// fixed 64-byte records sequentially and resolves city strings through
+/// the offset-based string table - nothing is allocated per record
+fn analyze_person_file_bytes(data: &[u8]) -> ffi::HealthColumns {
+    let empty = ffi::HealthColumns {
+        bmis: Vec::new(),
+        risk_scores: Vec::new(),
+    };
+
+    if data.len() < PERSON_FILE_HEADER_SIZE
+        || read_u32(data, 0) != PERSON_FILE_MAGIC
+        || read_u32(data, 4) != PERSON_FILE_VERSION
+    {
+        return empty;
+    }
+
+    let record_count = read_u64(data, 8) as usize;
+    let string_table_offset = read_u64(data, 16) as usize;
+    if string_table_offset > data.len()
+        || PERSON_FILE_HEADER_SIZE + record_count * PERSON_FILE_RECORD_SIZE > string_table_offset
+    {
+        return empty;
+    }
+    let strings = &data[string_table_offset..];
+
+    let mut bmis = Vec::with_capacity(record_count);
+    let mut risk_scores = Vec::with_capacity(record_count);
+
+    for i in 0..record_count {
+        let base = PERSON_FILE_HEADER_SIZE + i * PERSON_FILE_RECORD_SIZE;
+        let age = read_u32(data, base);
+        let height = read_f64(data, base + 8);
+        let weight = read_f64(data, base + 16);
+        let city_off = read_u32(data, base + 32) as usize;
+        let city_len = read_u32(data, base + 36) as usize;
+
+        let bmi = if height > 0.0 { weight / (height * height) } else { 0.0 };
+
+        let city = strings
+            .get(city_off..city_off + city_len)
+            .and_then(|bytes| std::str::from_utf8(bytes).ok())
+            .unwrap_or("");
+
+        let age_risk = if age < 18 || age > 65 { 1.5 } else { 1.0 };
+        let bmi_risk = if bmi < 18.5 || bmi > 25.0 { 1.3 } else { 1.0 };
+        let risk_score = age_risk * bmi_risk * city_risk_factor(city);
+
+        bmis.push(bmi);
+        risk_scores.push(risk_score);
+    }
+
+    ffi::HealthColumns { bmis, risk_scores }
+}
+
+/// Health analysis over a memory-mapped person record file
+///
+/// The whole mapping comes across the bridge as one pointer+length; the
+/// sequential scan then runs at memory/disk bandwidth with no per-record
+/// FFI calls, std::string construction, or shared_ptr chasing
+fn analyze_health_file(file: &ffi::PersonFile) -> ffi::HealthColumns {
+    let len = ffi::person_file_size_bytes(file);
+    let ptr = ffi::person_file_data_ptr(file);
+    if ptr.is_null() || len == 0 {
+        return ffi::HealthColumns {
+            bmis: Vec::new(),
+            risk_scores: Vec::new(),
+        };
+    }
+
+    // Safety: the pointer covers the live mapping, which outlives this call
+    let data = unsafe { std::slice::from_raw_parts(ptr, len) };
+    analyze_person_file_bytes(data)
+}
+
+/// Greet a person by name
+/// 
+/// Simple function demonstrating string handling
+fn greet_person(name: &str) -> usize {
+    if name.is_empty() {
+        println!("Hello, stranger!");
+        return 0;
+    }
+    
+    println!("Hello from Rust, {}!", name);
+    name.len()
+}
+
+/// Calculate BMI from weight and height
+/// 
+/// Pure Rust calculation - no C++ interaction
+fn calculate_bmi(weight_kg: f64, height_m: f64) -> f64 {
+    if height_m <= 0.0 {
+        return 0.0;
+    }
+    weight_kg / (height_m * height_m)
+}
+
+/// Validate contact information
+/// 
+/// Demonstrates deep access into nested C++ objects:
+/// ContactInfo -> Address -> fields
+fn validate_contact(contact: &ffi::ContactInfo) -> bool {
+    validate_contact_detailed(contact) == 0
+}
+
+// Failure bits returned by validate_contact_detailed / validate_contact_batch
+// (mirror these values in C++ callers that decode the mask)
+const VALIDATION_FAIL_EMAIL: u32 = 1 << 0;
+const VALIDATION_FAIL_PHONE: u32 = 1 << 1;
+const VALIDATION_FAIL_CITY: u32 = 1 << 2;
+const VALIDATION_FAIL_POSTAL: u32 = 1 << 3;
+
+/// Apply the validation rules to raw field values
+///
+/// Pure function returning the failure bitmask (0 = all rules passed)
+fn validate_fields(email: &str, phone: &str, city: &str, postal: &str) -> u32 {
+    let mut failures = 0;
+    if !(email.contains('@') && email.len() > 3) {
+        failures |= VALIDATION_FAIL_EMAIL;
+    }
+    if phone.len() < 7 {
+        failures |= VALIDATION_FAIL_PHONE;
+    }
+    if city.is_empty() {
+        failures |= VALIDATION_FAIL_CITY;
+    }
+    if postal.len() < 5 {
+        failures |= VALIDATION_FAIL_POSTAL;
+    }
+    failures
+}
+
+/// Wide byte search, scalar tail - the memchr technique on stable std
+///
+/// XORs the needle across an 8-byte word and applies the SWAR zero-byte
+/// test, so the '@' scan runs a word at a time instead of per byte.
+/// (The memchr crate would add explicit SIMD; this is the
+/// dependency-free equivalent.)
+fn contains_byte(haystack: &[u8], needle: u8) -> bool {
+    const LO: u64 = 0x0101_0101_0101_0101;
+    const HI: u64 = 0x8080_8080_8080_8080;
+    let pattern = LO * needle as u64;
+    let mut chunks = haystack.chunks_exact(8);
+    for chunk in &mut chunks {
+        let word = u64::from_ne_bytes(chunk.try_into().unwrap()) ^ pattern;
+        if word.wrapping_sub(LO) & !word & HI != 0 {
+            return true;
+        }
+    }
+    chunks.remainder().contains(&needle)
+}
+
+/// validate_fields over raw bytes - the packed-batch path
+/// (keep the rules in sync with validate_fields)
+fn validate_fields_bytes(email: &[u8], phone: &[u8], city: &[u8], postal: &[u8]) -> u32 {
+    let mut failures = 0;
+    if !(email.len() > 3 && contains_byte(email, b'@')) {
+        failures |= VALIDATION_FAIL_EMAIL;
+    }
+    if phone.len() < 7 {
+        failures |= VALIDATION_FAIL_PHONE;
+    }
+    if city.is_empty() {
+        failures |= VALIDATION_FAIL_CITY;
+    }
+    if postal.len() < 5 {
+        failures |= VALIDATION_FAIL_POSTAL;
+    }
+    failures
+}
+
+/// Validate a whole packed batch in one crossing
+///
+/// `offsets` carries 4 entries per record plus one trailing end, so
+/// record i's email/phone/city/postal are the byte spans between
+/// offsets[4i]..offsets[4i+4+1]. The scan walks the contiguous buffer
+/// with no getter calls and no copies - out-of-range spans validate as
+/// empty fields rather than panicking.
+fn validate_contact_packed(bytes: &[u8], offsets: &[u32]) -> Vec<u32> {
+    if offsets.len() < 5 {
+        return Vec::new();
+    }
+    let field = |from: u32, to: u32| -> &[u8] {
+        bytes.get(from as usize..to as usize).unwrap_or(&[])
+    };
+    let records = (offsets.len() - 1) / 4;
+    let mut masks = Vec::with_capacity(records);
+    for record in 0..records {
+        let o = &offsets[4 * record..4 * record + 5];
+        masks.push(validate_fields_bytes(
+            field(o[0], o[1]),
+            field(o[1], o[2]),
+            field(o[2], o[3]),
+            field(o[3], o[4]),
+        ));
+    }
+    masks
+}
+
+/// Validate contact information with per-rule failure detail
+///
+/// One pass produces the full failure bitmask, replacing the old
+/// validate-then-revalidate-in-C++ pattern when a record fails
+fn validate_contact_detailed(contact: &ffi::ContactInfo) -> u32 {
+    let _entry = bridge_stats::entry();
+    // Extract data from nested C++ objects
+    let email = ffi::get_contact_email(contact);
+    let phone = ffi::get_contact_phone(contact);
+    let address = ffi::get_contact_address(contact);
+    let city = ffi::get_address_city(address);
+    let postal_code = ffi::get_address_postal_code(address);
+
+    validate_fields(
+        email.to_str().unwrap_or(""),
+        phone.to_str().unwrap_or(""),
+        city.to_str().unwrap_or(""),
+        postal_code.to_str().unwrap_or(""),
+    )
+}
+
+/// Validate many contacts in a single FFI crossing
+///
+/// # Safety
+/// `contacts` must point to `count` valid, non-null `const ContactInfo*`
+/// entries that stay alive for the duration of the call
+unsafe fn validate_contact_batch(
+    contacts: *const *const ffi::ContactInfo,
+    count: usize,
+) -> Vec<u32> {
+    if contacts.is_null() || count == 0 {
+        return Vec::new();
+    }
+
+    let slice = std::slice::from_raw_parts(contacts, count);
+    slice
+        .iter()
+        .map(|&c| validate_contact_detailed(&*c))
+        .collect()
+}
+
+// ============================================================================
+// STABLE C ABI - for runtime loading via dlopen
+// cxx mangles its symbols, so DynamicRustLibrary (main.cpp) resolves this
+// versioned function-pointer table once at load instead of guessing names
+// ============================================================================
+
+/// ABI version of the exported table - bump whenever the layout changes
+pub const RS_API_VERSION: u32 = 1;
+
+/// C-layout result struct for the extern "C" surface
+/// (mirrored as RsPersonInfo in main.cpp - keep field order in sync)
+#[repr(C)]
+pub struct RsPersonInfo {
+    pub is_adult: u8,
+    pub bmi_category: u8,
+    pub city_id: u32,
+    pub name_length: usize,
+}
+
+/// Versioned vtable handed to dynamic loaders in one dlsym call
+/// (mirrored as RsApiTable in main.cpp - keep field order in sync)
+#[repr(C)]
+pub struct RsApiTable {
+    pub version: u32,
+    pub calculate_bmi: extern "C" fn(f64, f64) -> f64,
+    pub greet_person: unsafe extern "C" fn(*const std::os::raw::c_char) -> usize,
+    pub process_person_batch:
+        unsafe extern "C" fn(*const *const ffi::Person, usize, *mut RsPersonInfo) -> usize,
+}
+
+#[no_mangle]
+pub extern "C" fn rs_calculate_bmi(weight_kg: f64, height_m: f64) -> f64 {
+    calculate_bmi(weight_kg, height_m)
+}
+
+/// # Safety
+/// `name` must be null or a valid NUL-terminated string
+#[no_mangle]
+pub unsafe extern "C" fn rs_greet_person(name: *const std::os::raw::c_char) -> usize {
+    if name.is_null() {
+        return greet_person("");
+    }
+    greet_person(std::ffi::CStr::from_ptr(name).to_str().unwrap_or(""))
+}
+
+/// # Safety
+/// `persons` must point to `count` valid `const Person*` entries and `out`
+/// must have room for `count` results
+#[no_mangle]
+pub unsafe extern "C" fn rs_process_person_batch(
+    persons: *const *const ffi::Person,
+    count: usize,
+    out: *mut RsPersonInfo,
+) -> usize {
+    if persons.is_null() || out.is_null() || count == 0 {
+        return 0;
+    }
+
+    let slice = std::slice::from_raw_parts(persons, count);
+    for (i, &p) in slice.iter().enumerate() {
+        let info = process_person_interned(&*p);
+        *out.add(i) = RsPersonInfo {
+            is_adult: info.is_adult as u8,
+            bmi_category: info.bmi_category,
+            city_id: info.city_id,
+            name_length: info.name_length,
+        };
+    }
+    count
+}
+
+static RS_API_TABLE: RsApiTable = RsApiTable {
+    version: RS_API_VERSION,
+    calculate_bmi: rs_calculate_bmi,
+    greet_person: rs_greet_person,
+    process_person_batch: rs_process_person_batch,
+};
+
+/// Single stable entry point for dynamic loaders: one dlsym resolves the
+/// whole API surface, and the version field guards against skew between
+/// the loader and a hot-swapped library
+#[no_mangle]
+pub extern "C" fn rs_get_api_table() -> *const RsApiTable {
+    &RS_API_TABLE
+}
+
+// ============================================================================
+// TESTS
+// ============================================================================
 
 #[cfg(test)]
 mod tests {
@@ -261,6 +2117,268 @@ mod tests {
         assert_eq!(bmi, 0.0);
     }
 
+    #[test]
+    fn test_api_table_version() {
+        let table = unsafe { &*rs_get_api_table() };
+        assert_eq!(table.version, RS_API_VERSION);
+        assert!(((table.calculate_bmi)(70.0, 1.75) - 22.86).abs() < 0.01);
+    }
+
+    #[test]
+    fn test_bmi_column() {
+        let bmis = bmi_column(&[70.0, 55.0], &[1.75, 0.0]);
+        assert!((bmis[0] - 22.86).abs() < 0.01);
+        assert_eq!(bmis[1], 0.0);
+    }
+
+    #[test]
+    fn test_risk_score_column() {
+        // Adult with normal BMI in a neutral city -> baseline risk
+        // Minor with high BMI in city id 0 (risk 1.2) -> all factors apply
+        let risks = risk_score_column(&[30, 16], &[22.0, 27.0], &[1, 0], &[1.2, 1.0]);
+        assert!((risks[0] - 1.0).abs() < 1e-9);
+        assert!((risks[1] - 1.5 * 1.3 * 1.2).abs() < 1e-9);
+    }
+
+    /// Build a one-record file image matching the person_file.h layout
+    fn build_test_file(age: u32, height: f64, weight: f64, city: &str) -> Vec<u8> {
+        let mut record = Vec::new();
+        record.extend_from_slice(&age.to_le_bytes());
+        record.extend_from_slice(&0u32.to_le_bytes()); // reserved
+        record.extend_from_slice(&height.to_le_bytes());
+        record.extend_from_slice(&weight.to_le_bytes());
+        // name (empty), city, email/phone/postal (empty)
+        record.extend_from_slice(&0u32.to_le_bytes());
+        record.extend_from_slice(&0u32.to_le_bytes());
+        record.extend_from_slice(&0u32.to_le_bytes());
+        record.extend_from_slice(&(city.len() as u32).to_le_bytes());
+        for _ in 0..6 {
+            record.extend_from_slice(&0u32.to_le_bytes());
+        }
+        assert_eq!(record.len(), PERSON_FILE_RECORD_SIZE);
+
+        let mut data = Vec::new();
+        data.extend_from_slice(&PERSON_FILE_MAGIC.to_le_bytes());
+        data.extend_from_slice(&PERSON_FILE_VERSION.to_le_bytes());
+        data.extend_from_slice(&1u64.to_le_bytes()); // record count
+        let string_table_offset = (PERSON_FILE_HEADER_SIZE + PERSON_FILE_RECORD_SIZE) as u64;
+        data.extend_from_slice(&string_table_offset.to_le_bytes());
+        data.extend_from_slice(&record);
+        data.extend_from_slice(city.as_bytes());
+        data
+    }
+
+    #[test]
+    fn test_analyze_person_file_bytes() {
+        let data = build_test_file(30, 1.75, 70.0, "New York");
+        let columns = analyze_person_file_bytes(&data);
+        assert_eq!(columns.bmis.len(), 1);
+        assert!((columns.bmis[0] - 22.86).abs() < 0.01);
+        // Adult, normal BMI, New York -> risk = 1.0 * 1.0 * 1.2
+        assert!((columns.risk_scores[0] - 1.2).abs() < 1e-9);
+    }
+
+    #[test]
+    fn test_analyze_person_file_bytes_rejects_bad_magic() {
+        let mut data = build_test_file(30, 1.75, 70.0, "Boston");
+        data[0] ^= 0xFF;
+        assert!(analyze_person_file_bytes(&data).bmis.is_empty());
+    }
+
+    #[test]
+    fn test_recommendation_id_thresholds() {
+        assert_eq!(recommendation_id(1.0), 0);
+        assert_eq!(recommendation_id(1.3), 1);
+        assert_eq!(recommendation_id(2.0), 2);
+    }
+
+    #[test]
+    fn test_recommendation_text() {
+        assert!(recommendation_text(0).starts_with("Excellent"));
+        assert_eq!(recommendation_text(200), "");
+    }
+
+    #[test]
+    fn test_contains_byte() {
+        assert!(contains_byte(b"someone@example.com", b'@'));
+        assert!(!contains_byte(b"no-at-sign-here.com", b'@'));
+        assert!(contains_byte(b"tail-byte-case-xx@", b'@')); // in remainder
+        assert!(!contains_byte(b"", b'@'));
+    }
+
+    #[test]
+    fn test_validate_contact_packed() {
+        // Two records packed back to back: one fully valid, one that
+        // fails the email and postal rules
+        let mut bytes = Vec::new();
+        let mut offsets = vec![0u32];
+        for field in ["a@bc.com", "5551234", "Boston", "02101",
+                      "bad", "5551234", "Boston", "123"] {
+            bytes.extend_from_slice(field.as_bytes());
+            offsets.push(bytes.len() as u32);
+        }
+        let masks = validate_contact_packed(&bytes, &offsets);
+        assert_eq!(masks.len(), 2);
+        assert_eq!(masks[0], 0);
+        assert_eq!(masks[1], VALIDATION_FAIL_EMAIL | VALIDATION_FAIL_POSTAL);
+    }
+
+    #[test]
+    fn test_validate_fields_all_pass() {
+        assert_eq!(validate_fields("bob@example.com", "555-1234", "Boston", "02101"), 0);
+    }
+
+    #[test]
+    fn test_validate_fields_failure_bits() {
+        let mask = validate_fields("bademail", "123", "", "123");
+        assert_eq!(
+            mask,
+            VALIDATION_FAIL_EMAIL | VALIDATION_FAIL_PHONE | VALIDATION_FAIL_CITY
+                | VALIDATION_FAIL_POSTAL
+        );
+        assert_eq!(validate_fields("a@bc", "5551234", "Boston", "123"), VALIDATION_FAIL_POSTAL);
+    }
+
+    #[test]
+    fn test_city_risk_factor() {
+        assert_eq!(city_risk_factor("New York"), 1.2);
+        assert_eq!(city_risk_factor("Nowhere"), 1.0);
+    }
+
+    fn test_snapshot() -> ffi::PersonSnapshot {
+        ffi::PersonSnapshot {
+            age: 30,
+            height: 1.75,
+            name: "Test Person".to_string(),
+            city: "Boston".to_string(),
+            email: "t@example.com".to_string(),
+            phone: "555-1234".to_string(),
+            postal_code: "02101".to_string(),
+        }
+    }
+
+    #[test]
+    fn test_analyze_snapshot() {
+        let analysis = analyze_snapshot(&test_snapshot(), 70.0);
+        assert!((analysis.bmi - 70.0 / (1.75 * 1.75)).abs() < 1e-9);
+        assert_eq!(analysis.risk_score, 1.0);
+        assert_eq!(analysis.city_risk_factor, 1.0);
+    }
+
+    #[test]
+    fn test_async_submit_and_poll() {
+        let ticket = analysis_submit(test_snapshot(), 70.0);
+        assert_ne!(ticket, 0);
+        let deadline = std::time::Instant::now() + std::time::Duration::from_secs(5);
+        loop {
+            if let Some(done) = analysis_poll_completions()
+                .into_iter()
+                .find(|c| c.ticket == ticket)
+            {
+                assert!(done.analysis.bmi > 0.0);
+                break;
+            }
+            assert!(std::time::Instant::now() < deadline, "completion never arrived");
+            std::thread::sleep(std::time::Duration::from_millis(1));
+        }
+    }
+
+    #[test]
+    fn test_calculate_bmi_bulk() {
+        // 6 rows: 4-lane chunk plus a 2-row remainder, and one zero height
+        let weights = [70.0, 80.0, 60.0, 55.0, 90.0, 70.0];
+        let heights = [1.75, 1.80, 1.60, 0.0, 1.90, 1.70];
+        let mut out = [0.0; 6];
+        assert_eq!(calculate_bmi_bulk(&weights, &heights, &mut out), 6);
+        for i in [0, 1, 2, 4, 5] {
+            assert!((out[i] - weights[i] / (heights[i] * heights[i])).abs() < 1e-9);
+        }
+        assert_eq!(out[3], 0.0);
+    }
+
+    #[test]
+    fn test_calculate_bmi_bulk_length_mismatch() {
+        let mut out = [0.0; 8];
+        assert_eq!(calculate_bmi_bulk(&[70.0, 80.0], &[1.75], &mut out), 1);
+    }
+
+    #[test]
+    fn test_risk_score_bulk() {
+        let ages = [30, 70, 16];
+        let bmis = [22.0, 26.0, 22.0];
+        let city_risks = [1.0, 1.2, 1.0];
+        let mut out = [0.0; 3];
+        assert_eq!(risk_score_bulk(&ages, &bmis, &city_risks, &mut out), 3);
+        assert!((out[0] - 1.0).abs() < 1e-9);
+        assert!((out[1] - 1.5 * 1.3 * 1.2).abs() < 1e-9);
+        assert!((out[2] - 1.5).abs() < 1e-9);
+    }
+
+    #[test]
+    fn test_analysis_cache_roundtrip() {
+        let capacity = analysis_cache::set_capacity(100);
+        assert_eq!(capacity, 128); // rounded up to a power of two
+        let key = analysis_cache::Key {
+            age: 30,
+            height_cm: 175,
+            weight_kg: 70,
+            city_id: 1,
+        };
+        assert!(analysis_cache::get(&key).is_none());
+        analysis_cache::insert(
+            key,
+            analysis_cache::Value {
+                bmi: 22.9,
+                risk_score: 1.0,
+                city_risk_factor: 1.0,
+                recommendation_id: 0,
+            },
+        );
+        let value = analysis_cache::get(&key).expect("inserted key");
+        assert_eq!(value.bmi, 22.9);
+        assert!(analysis_cache::hits() >= 1);
+        analysis_cache::set_capacity(0); // leave disabled for other tests
+    }
+
+    #[test]
+    fn test_parse_risk_table() {
+        let table = parse_risk_table(
+            "# city risk table\nChicago, 1.15\nSan Francisco,1.05\n\nbadline\nNoRisk,abc\n",
+        );
+        assert_eq!(table.len(), 2);
+        assert_eq!(table["Chicago"], 1.15);
+        assert_eq!(table["San Francisco"], 1.05);
+    }
+
+    #[test]
+    fn test_parse_risk_table_city_with_comma() {
+        let table = parse_risk_table("Washington, D.C.,1.3\n");
+        assert_eq!(table["Washington, D.C."], 1.3);
+    }
+
+    #[test]
+    fn test_inline_str24_fits() {
+        let s = inline_str24("Boston");
+        assert_eq!(s.len, 6);
+        assert_eq!(&s.bytes[..6], b"Boston");
+        assert!(!inline_str_overflowed(&s));
+    }
+
+    #[test]
+    fn test_inline_str24_exact_capacity() {
+        let text = "x".repeat(24);
+        let s = inline_str24(&text);
+        assert_eq!(s.len, 24);
+        assert!(!inline_str_overflowed(&s));
+    }
+
+    #[test]
+    fn test_inline_str24_overflow() {
+        let s = inline_str24("Llanfairpwllgwyngyllgogerychwyrndrobwll");
+        assert!(inline_str_overflowed(&s));
+        assert_eq!(&s.bytes[..], &"Llanfairpwllgwyngyllgogerychwyrndrobwll".as_bytes()[..24]);
+    }
+
     // Note: Tests involving C++ types would need C++ test framework
     // or integration tests. Pure Rust functions can be unit tested here.
 }